@@ -0,0 +1,31 @@
+﻿// Copyright (c) Jared Taylor
+
+using UnrealBuildTool;
+
+public class GraspReplicationGraph : ModuleRules
+{
+	public GraspReplicationGraph(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"GameplayAbilities",
+				"TargetingSystem",
+				"ReplicationGraph",
+				"Grasp",
+			}
+			);
+			
+		
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+			}
+			);
+	}
+}
@@ -0,0 +1,17 @@
+﻿// Copyright (c) Jared Taylor
+
+#include "GraspReplicationGraph.h"
+
+#define LOCTEXT_NAMESPACE "FGraspReplicationGraphModule"
+
+void FGraspReplicationGraphModule::StartupModule()
+{
+}
+
+void FGraspReplicationGraphModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+    
+IMPLEMENT_MODULE(FGraspReplicationGraphModule, GraspReplicationGraph)
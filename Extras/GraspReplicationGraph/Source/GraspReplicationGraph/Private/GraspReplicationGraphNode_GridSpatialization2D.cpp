@@ -0,0 +1,112 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspReplicationGraphNode_GridSpatialization2D.h"
+
+#include "GraspableComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspReplicationGraphNode_GridSpatialization2D)
+
+
+void UGraspReplicationGraphNode_GridSpatialization2D::GatherActorsInRadius2D(const FVector& Location, float Radius,
+	TSet<AActor*>& OutActors) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspReplicationGraphNode_GridSpatialization2D::GatherActorsInRadius2D);
+
+	if (CellSize <= 0.f || GraspableActors.Num() == 0)
+	{
+		return;
+	}
+
+	// Actors are placed in every cell their cull distance covers, so only the cells the circle touches need reading
+	const float SearchRadius = Radius + MaxGraspableRadius;
+	const FIntPoint MinCell = GetGridCell(Location - FVector(SearchRadius, SearchRadius, 0.f));
+	const FIntPoint MaxCell = GetGridCell(Location + FVector(SearchRadius, SearchRadius, 0.f));
+
+	TArray<FActorRepListType> CellActors;
+	for (int32 X = MinCell.X; X <= MaxCell.X && X < Grid.Num(); X++)
+	{
+		const TArray<UReplicationGraphNode_GridCell*>& GridX = Grid[X];
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y && Y < GridX.Num(); Y++)
+		{
+			const UReplicationGraphNode_GridCell* Cell = GridX[Y];
+			if (!Cell)
+			{
+				continue;
+			}
+
+			CellActors.Reset();
+			Cell->GetAllActorsInNode_Debugging(CellActors);
+			for (AActor* Actor : CellActors)
+			{
+				if (IsValid(Actor) && GraspableActors.Contains(Actor))
+				{
+					OutActors.Add(Actor);
+				}
+			}
+		}
+	}
+}
+
+void UGraspReplicationGraphNode_GridSpatialization2D::AddActorInternal_Dynamic(const FNewReplicatedActorInfo& ActorInfo)
+{
+	Super::AddActorInternal_Dynamic(ActorInfo);
+
+	OnGraspableAdded(ActorInfo.Actor);
+}
+
+void UGraspReplicationGraphNode_GridSpatialization2D::AddActorInternal_Static(const FNewReplicatedActorInfo& ActorInfo,
+	FGlobalActorReplicationInfo& ActorRepInfo, bool bDormancyDriven)
+{
+	Super::AddActorInternal_Static(ActorInfo, ActorRepInfo, bDormancyDriven);
+
+	OnGraspableAdded(ActorInfo.Actor);
+}
+
+void UGraspReplicationGraphNode_GridSpatialization2D::RemoveActorInternal_Dynamic(const FNewReplicatedActorInfo& ActorInfo)
+{
+	Super::RemoveActorInternal_Dynamic(ActorInfo);
+
+	GraspableActors.Remove(ActorInfo.Actor);
+}
+
+void UGraspReplicationGraphNode_GridSpatialization2D::RemoveActorInternal_Static(const FNewReplicatedActorInfo& ActorInfo,
+	FGlobalActorReplicationInfo& ActorRepInfo, bool bWasAddedAsDormantActor)
+{
+	Super::RemoveActorInternal_Static(ActorInfo, ActorRepInfo, bWasAddedAsDormantActor);
+
+	GraspableActors.Remove(ActorInfo.Actor);
+}
+
+void UGraspReplicationGraphNode_GridSpatialization2D::OnGraspableAdded(AActor* Actor)
+{
+	if (HasGraspableComponent(Actor))
+	{
+		GraspableActors.Add(Actor);
+		MaxGraspableRadius = FMath::Max(MaxGraspableRadius, Actor->GetSimpleCollisionRadius());
+	}
+}
+
+bool UGraspReplicationGraphNode_GridSpatialization2D::HasGraspableComponent(const AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return false;
+	}
+
+	TInlineComponentArray<UPrimitiveComponent*> Components(Actor);
+	return Components.ContainsByPredicate([](const UPrimitiveComponent* Component)
+	{
+		return Cast<IGraspableComponent>(Component) != nullptr;
+	});
+}
+
+FIntPoint UGraspReplicationGraphNode_GridSpatialization2D::GetGridCell(const FVector& Location) const
+{
+	// The base node clamps everything below the spatial bias into the first row and column
+	const float InvCellSize = 1.f / CellSize;
+	return FIntPoint(FMath::Max(0, FMath::FloorToInt((Location.X - SpatialBias.X) * InvCellSize)),
+		FMath::Max(0, FMath::FloorToInt((Location.Y - SpatialBias.Y) * InvCellSize)));
+}
@@ -0,0 +1,164 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspTargetSelection_ReplicationGraph.h"
+
+#include "GraspableComponent.h"
+#include "GraspReplicationGraphInterface.h"
+#include "GraspReplicationGraphNode_GridSpatialization2D.h"
+#include "Engine/NetDriver.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/ReplicationDriver.h"
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+#include "Targeting/GraspTargetingRequestData.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspTargetSelection_ReplicationGraph)
+
+
+void UGraspTargetSelection_ReplicationGraph::Execute(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection_ReplicationGraph::Execute);
+
+	// Scan LOD fine tier has no broadphase, let the base class handle it
+	if (const FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle))
+	{
+		if (RequestData->Tier == EGraspScanTier::Fine)
+		{
+			Super::Execute(TargetingHandle);
+			return;
+		}
+	}
+
+	// No replication graph, use the physics overlap
+	const UGraspReplicationGraphNode_GridSpatialization2D* GridNode = GetGridNode(TargetingHandle);
+	if (!GridNode)
+	{
+		Super::Execute(TargetingHandle);
+		return;
+	}
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Executing);
+
+	ExecuteGridQuery(TargetingHandle, GridNode);
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+}
+
+void UGraspTargetSelection_ReplicationGraph::ExecuteNative(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection_ReplicationGraph::ExecuteNative);
+
+	// Scan LOD fine tier has no broadphase, let the base class handle it
+	if (const FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle))
+	{
+		if (RequestData->Tier == EGraspScanTier::Fine)
+		{
+			Super::ExecuteNative(TargetingHandle);
+			return;
+		}
+	}
+
+	if (const UGraspReplicationGraphNode_GridSpatialization2D* GridNode = GetGridNode(TargetingHandle))
+	{
+		ExecuteGridQuery(TargetingHandle, GridNode);
+	}
+	else
+	{
+		Super::ExecuteNative(TargetingHandle);
+	}
+}
+
+UGraspReplicationGraphNode_GridSpatialization2D* UGraspTargetSelection_ReplicationGraph::GetGridNode(
+	const FTargetingRequestHandle& TargetingHandle) const
+{
+	const UWorld* World = GetSourceContextWorld(TargetingHandle);
+	const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+	if (!NetDriver || !NetDriver->IsServer())
+	{
+		return nullptr;
+	}
+
+	if (const IGraspReplicationGraph* Graph = Cast<IGraspReplicationGraph>(NetDriver->GetReplicationDriver()))
+	{
+		return Graph->GetGraspGridNode();
+	}
+	return nullptr;
+}
+
+void UGraspTargetSelection_ReplicationGraph::ExecuteGridQuery(const FTargetingRequestHandle& TargetingHandle,
+	const UGraspReplicationGraphNode_GridSpatialization2D* GridNode) const
+{
+#if UE_ENABLE_DEBUG_DRAWING
+	ResetDebugString(TargetingHandle);
+#endif
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection_ReplicationGraph::ExecuteGridQuery);
+
+	if (!TargetingHandle.IsValid())
+	{
+		return;
+	}
+
+	const FGraspSelectionContext& Context = MakeSelectionContext(TargetingHandle);
+	const FVector SourceLocation = Context.ShapeLocation;
+
+	// Bounding sphere of the selection shape, the grid is coarse so the shape rotation is not considered
+	const FCollisionShape& CollisionShape = Context.CollisionShape;
+	float BoundingRadius = 0.f;
+	if (CollisionShape.IsBox())
+	{
+		BoundingRadius = CollisionShape.GetBox().Size();
+	}
+	else if (CollisionShape.IsCapsule())
+	{
+		BoundingRadius = FMath::Max(CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius());
+	}
+	else
+	{
+		BoundingRadius = CollisionShape.GetSphereRadius();
+	}
+
+	TSet<AActor*> Actors;
+	GridNode->GatherActorsInRadius2D(SourceLocation, BoundingRadius, Actors);
+
+	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
+	const AActor* SourceActor = SourceContext && bIgnoreSourceActor ? SourceContext->SourceActor.Get() : nullptr;
+	const AActor* InstigatorActor = SourceContext && bIgnoreInstigatorActor ? SourceContext->InstigatorActor.Get() : nullptr;
+
+	// Convert to overlap results so the base class can process them as it would a physics overlap
+	TArray<FOverlapResult> OverlapResults;
+	TArray<UPrimitiveComponent*> Components;
+	for (AActor* Actor : Actors)
+	{
+		if (!IsValid(Actor) || Actor == SourceActor || Actor == InstigatorActor)
+		{
+			continue;
+		}
+
+		Components.Reset();
+		Actor->GetComponents<UPrimitiveComponent>(Components);
+		for (UPrimitiveComponent* Component : Components)
+		{
+			if (!Cast<IGraspableComponent>(Component))
+			{
+				continue;
+			}
+
+			const float MaxDistance = BoundingRadius + Component->Bounds.SphereRadius;
+			if (FVector::DistSquared(Component->Bounds.Origin, SourceLocation) > FMath::Square(MaxDistance))
+			{
+				continue;
+			}
+
+			FOverlapResult& Result = OverlapResults.AddDefaulted_GetRef();
+			Result.OverlapObjectHandle = FActorInstanceHandle(Actor);
+			Result.Component = Component;
+			Result.bBlockingHit = false;
+		}
+	}
+
+	ProcessOverlapResults(TargetingHandle, OverlapResults);
+
+	ReleaseSelectionContext(TargetingHandle);
+}
@@ -0,0 +1,13 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+class FGraspReplicationGraphModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
@@ -0,0 +1,28 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+
+#include "GraspReplicationGraphInterface.generated.h"
+
+class UGraspReplicationGraphNode_GridSpatialization2D;
+
+UINTERFACE(meta=(CannotImplementInterfaceInBlueprint))
+class GRASPREPLICATIONGRAPH_API UGraspReplicationGraph : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Add to your UReplicationGraph subclass to let UGraspTargetSelection_ReplicationGraph find the grid
+ */
+class GRASPREPLICATIONGRAPH_API IGraspReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	/** The grid spatialization node created by the graph, nullptr if it has not been created */
+	virtual UGraspReplicationGraphNode_GridSpatialization2D* GetGraspGridNode() const PURE_VIRTUAL(, return nullptr;);
+};
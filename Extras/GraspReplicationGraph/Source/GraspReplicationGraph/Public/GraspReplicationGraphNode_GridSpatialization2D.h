@@ -0,0 +1,51 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "UObject/ObjectKey.h"
+#include "GraspReplicationGraphNode_GridSpatialization2D.generated.h"
+
+/**
+ * Grid spatialization node that can be queried for the graspable actors around a location
+ * Use in place of UReplicationGraphNode_GridSpatialization2D in your UReplicationGraph
+ * and return it from IGraspReplicationGraph::GetGraspGridNode()
+ *
+ * Only sees actors that your graph routes to this node, it cannot see:
+ * - Graspables on actors that do not replicate
+ * - Graspables on actors routed to other nodes, e.g. always relevant or owner relevant actors
+ * Use UGraspTargetSelection for presets that need to find those
+ */
+UCLASS()
+class GRASPREPLICATIONGRAPH_API UGraspReplicationGraphNode_GridSpatialization2D : public UReplicationGraphNode_GridSpatialization2D
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Gather the graspable actors in the grid cells the circle covers
+	 * Reads the cells the base node already maintains for replication, static, dynamic and dormant actors alike
+	 */
+	void GatherActorsInRadius2D(const FVector& Location, float Radius, TSet<AActor*>& OutActors) const;
+
+protected:
+	virtual void AddActorInternal_Dynamic(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual void AddActorInternal_Static(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& ActorRepInfo, bool bDormancyDriven) override;
+	virtual void RemoveActorInternal_Dynamic(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual void RemoveActorInternal_Static(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& ActorRepInfo, bool bWasAddedAsDormantActor) override;
+
+	/** @return True if the actor has a component that implements IGraspableComponent */
+	static bool HasGraspableComponent(const AActor* Actor);
+
+	void OnGraspableAdded(AActor* Actor);
+
+	/** Cell of the base grid containing the location, matching how the base node places actors */
+	FIntPoint GetGridCell(const FVector& Location) const;
+
+	/** Actors added to this node that have a graspable component, so cell contents can be filtered without walking components */
+	TSet<TObjectKey<AActor>> GraspableActors;
+
+	/** Largest bounding radius of any graspable added, cells are searched this much further */
+	float MaxGraspableRadius = 0.f;
+};
@@ -0,0 +1,32 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Targeting/GraspTargetSelection.h"
+#include "GraspTargetSelection_ReplicationGraph.generated.h"
+
+class UGraspReplicationGraphNode_GridSpatialization2D;
+
+/**
+ * Gathers graspable candidates from the replication graph grid node around the targeting source
+ * Avoids a physics overlap on servers that already maintain the grid for replication
+ * Falls back to UGraspTargetSelection when the net driver has no IGraspReplicationGraph
+ * Graspables that are not replicated or are routed to other nodes are not found, see UGraspReplicationGraphNode_GridSpatialization2D
+ */
+UCLASS(Blueprintable, DisplayName="Grasp Target Selection (Replication Graph)")
+class GRASPREPLICATIONGRAPH_API UGraspTargetSelection_ReplicationGraph : public UGraspTargetSelection
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Execute(const FTargetingRequestHandle& TargetingHandle) const override;
+	virtual void ExecuteNative(const FTargetingRequestHandle& TargetingHandle) const override;
+
+protected:
+	/** Find the grid node from the replication graph for the world of the targeting request */
+	UGraspReplicationGraphNode_GridSpatialization2D* GetGridNode(const FTargetingRequestHandle& TargetingHandle) const;
+
+	/** Gather graspable components from the grid and store them in the targeting result data */
+	void ExecuteGridQuery(const FTargetingRequestHandle& TargetingHandle, const UGraspReplicationGraphNode_GridSpatialization2D* GridNode) const;
+};
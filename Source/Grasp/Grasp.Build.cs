@@ -28,7 +28,10 @@ public class Grasp : ModuleRules
 				"Engine",
 				"AIModule",
 				"UMG",
+				"Json",
 			}
 			);
+
+		SetupGameplayDebuggerSupport(Target);
 	}
 }
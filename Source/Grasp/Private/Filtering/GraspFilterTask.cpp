@@ -0,0 +1,185 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Filtering/GraspFilterTask.h"
+
+#include "GraspDataRuntime.h"
+#include "GraspStats.h"
+#include "Targeting/GraspTargetingRequestData.h"
+#include "Algo/BinarySearch.h"
+#include "Types/TargetingSystemTypes.h"
+#include "VisualLogger/VisualLogger.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilterTask)
+
+
+FGraspFilterContext FGraspFilterContext::Make(const FTargetingRequestHandle& TargetingHandle)
+{
+	FGraspFilterContext Context;
+	Context.TargetingHandle = TargetingHandle;
+
+	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
+	if (SourceContext && IsValid(SourceContext->SourceActor))
+	{
+		Context.SourceActor = SourceContext->SourceActor;
+		Context.SourceLocation = Context.SourceActor->GetActorLocation();
+		Context.NetToleranceIndex = FGraspDataRuntime::GetNetToleranceIndex(Context.SourceActor);
+	}
+	return Context;
+}
+
+UGraspFilterTask::UGraspFilterTask(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{}
+
+void UGraspFilterTask::Execute(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilterTask::Execute);
+	CSV_SCOPED_TIMING_STAT(Grasp, Filters);
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Executing);
+
+	if (FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle))
+	{
+		const FGraspFilterContext Context = FGraspFilterContext::Make(TargetingHandle);
+		const int32 NumBefore = Results->TargetResults.Num();
+
+#if ENABLE_DRAW_DEBUG
+		// The Targeting System debugger shows the targets each filter removed, recorded here as the base Execute() would
+		const bool bTargetingDebugging = IsTargetingDebuggingEnabled();
+		if (bTargetingDebugging)
+		{
+			ResetDebugFilteredTargets(TargetingHandle);
+		}
+#endif
+
+		// Everything from the first target beyond the max range is too far
+		if (FiltersBeyondMaxRange() && Context.SourceActor)
+		{
+			const int32 Cutoff = GetMaxRangeCutoff(Context, Results->TargetResults);
+			const int32 NumSkipped = Results->TargetResults.Num() - Cutoff;
+			if (NumSkipped > 0)
+			{
+#if ENABLE_DRAW_DEBUG
+				if (bTargetingDebugging)
+				{
+					for (int32 i = Cutoff; i < Results->TargetResults.Num(); i++)
+					{
+						AddDebugFilteredTarget(TargetingHandle, Results->TargetResults[i]);
+					}
+				}
+#endif
+				Results->TargetResults.RemoveAt(Cutoff, NumSkipped);
+				INC_DWORD_STAT_BY(STAT_GraspTargetsSkippedBeyondMaxRange, NumSkipped);
+#if ENABLE_VISUAL_LOG
+				VisLogSkippedBeyondMaxRange(Context, NumSkipped);
+#endif
+			}
+		}
+
+		Results->TargetResults.RemoveAll([&](const FTargetingDefaultResultData& TargetData)
+		{
+			const bool bFiltered = ShouldFilterGraspTarget(Context, TargetData.HitResult.GetComponent());
+			if (bFiltered)
+			{
+#if ENABLE_VISUAL_LOG
+				VisLogRejected(Context, TargetData.HitResult.GetComponent());
+#endif
+#if ENABLE_DRAW_DEBUG
+				if (bTargetingDebugging)
+				{
+					AddDebugFilteredTarget(TargetingHandle, TargetData);
+				}
+#endif
+			}
+			return bFiltered;
+		});
+
+		RecordFilterCount(TargetingHandle, NumBefore, Results->TargetResults.Num());
+	}
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+}
+
+void UGraspFilterTask::RecordFilterCount(const FTargetingRequestHandle& TargetingHandle, int32 NumBefore, int32 NumAfter) const
+{
+	FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle);
+	if (RequestData && RequestData->bCollectDebug)
+	{
+		RequestData->FilterCounts.Add({ GetFName(), NumBefore, NumAfter });
+	}
+}
+
+int32 UGraspFilterTask::GetMaxRangeCutoff(const FGraspFilterContext& Context,
+	const TArray<FTargetingDefaultResultData>& TargetResults)
+{
+	// Results from other selection tasks have no score, and are never cut off
+	const FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(Context.TargetingHandle);
+	if (!RequestData || !RequestData->bSortedByDistance)
+	{
+		return TargetResults.Num();
+	}
+
+	// No UGraspData has registered yet, data created at runtime registers lazily once it is first filtered
+	const float MaxRangeSq = FGraspDataRuntimeTable::Get().GetMaxRangeSq(Context.NetToleranceIndex);
+	if (MaxRangeSq <= 0.f)
+	{
+		return TargetResults.Num();
+	}
+
+	return Algo::UpperBoundBy(TargetResults, MaxRangeSq, &FTargetingDefaultResultData::Score);
+}
+
+#if ENABLE_DRAW_DEBUG
+bool UGraspFilterTask::IsTargetingDebuggingEnabled()
+{
+	static const IConsoleVariable* CVarTargetingDebugging = IConsoleManager::Get().FindConsoleVariable(TEXT("ts.debug.EnableTargetingDebugging"));
+	return CVarTargetingDebugging && CVarTargetingDebugging->GetBool();
+}
+
+void UGraspFilterTask::AddDebugFilteredTarget(const FTargetingRequestHandle& TargetingHandle,
+	const FTargetingDefaultResultData& TargetData) const
+{
+#if WITH_EDITORONLY_DATA
+	if (const AActor* Target = TargetData.HitResult.GetActor())
+	{
+		FTargetingDebugData& DebugData = FTargetingDebugData::FindOrAdd(TargetingHandle);
+		FString& ScratchPadString = DebugData.DebugScratchPadStrings.FindOrAdd(GetNameSafe(this));
+		ScratchPadString += TEXT(" ") + GetNameSafe(Target);
+	}
+#endif
+}
+
+void UGraspFilterTask::ResetDebugFilteredTargets(const FTargetingRequestHandle& TargetingHandle) const
+{
+#if WITH_EDITORONLY_DATA
+	FTargetingDebugData& DebugData = FTargetingDebugData::FindOrAdd(TargetingHandle);
+	DebugData.DebugScratchPadStrings.FindOrAdd(GetNameSafe(this)).Reset();
+#endif
+}
+#endif
+
+#if ENABLE_VISUAL_LOG
+void UGraspFilterTask::VisLogRejected(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent) const
+{
+	if (Context.SourceActor && TargetComponent)
+	{
+		UE_VLOG_LOCATION(Context.SourceActor, LogGraspScan, Verbose, TargetComponent->GetComponentLocation(), 8.f, FColor::Red,
+			TEXT("%s rejected %s"), *GetName(), *TargetComponent->GetName());
+	}
+}
+
+void UGraspFilterTask::VisLogSkippedBeyondMaxRange(const FGraspFilterContext& Context, int32 NumSkipped)
+{
+	if (Context.SourceActor)
+	{
+		UE_VLOG(Context.SourceActor, LogGraspScan, Verbose, TEXT("Skipped %d targets beyond the max range"), NumSkipped);
+	}
+}
+#endif
+
+bool UGraspFilterTask::ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle,
+	const FTargetingDefaultResultData& TargetData) const
+{
+	return ShouldFilterGraspTarget(FGraspFilterContext::Make(TargetingHandle), TargetData.HitResult.GetComponent());
+}
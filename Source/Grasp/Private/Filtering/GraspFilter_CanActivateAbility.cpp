@@ -4,6 +4,7 @@
 #include "Filtering/GraspFilter_CanActivateAbility.h"
 
 #include "GraspComponent.h"
+#include "GraspInteractorComponent.h"
 #include "GraspStatics.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilter_CanActivateAbility)
@@ -13,21 +14,26 @@ UGraspFilter_CanActivateAbility::UGraspFilter_CanActivateAbility(const FObjectIn
 	: Super(ObjectInitializer)
 {}
 
-bool UGraspFilter_CanActivateAbility::ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle,
-	const FTargetingDefaultResultData& TargetData) const
+bool UGraspFilter_CanActivateAbility::ShouldFilterGraspTarget(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent) const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_CanActivateAbility::ShouldFilterTarget);
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_CanActivateAbility::ShouldFilterGraspTarget);
 
-	// Find the source actor
-	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
-	if (!SourceContext || !IsValid(SourceContext->SourceActor))
+	// Requires the source actor
+	const AActor* SourceActor = Context.SourceActor;
+	if (!SourceActor)
 	{
 		return true;
 	}
 
-	// Get the grasp component from the source actor
-	const TObjectPtr<AActor> SourceActor = SourceContext->SourceActor;
-	const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
+	// Lightweight interactors don't use abilities, defer to the graspable's owner instead
+	if (!UGraspStatics::FindGraspComponentForActor(SourceActor))
+	{
+		if (const UGraspInteractorComponent* Interactor = UGraspStatics::FindGraspInteractorForActor(SourceActor))
+		{
+			return !Interactor->CanGraspInteract(TargetComponent);
+		}
+	}
 
 	// Filter out if we can't activate the ability
 	const bool CanActivateAbility = UGraspStatics::CanGraspActivateAbility(SourceActor, TargetComponent, Source);
@@ -5,7 +5,7 @@
 
 #include "GraspableComponent.h"
 #include "GraspableOwner.h"
-#include "GraspData.h"
+#include "GraspDataRuntime.h"
 #include "Abilities/GameplayAbility.h"
 #include "Components/PrimitiveComponent.h"
 
@@ -16,12 +16,12 @@ UGraspFilter_Graspable::UGraspFilter_Graspable(const FObjectInitializer& ObjectI
 	: Super(ObjectInitializer)
 {}
 
-bool UGraspFilter_Graspable::ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle,
-	const FTargetingDefaultResultData& TargetData) const
+bool UGraspFilter_Graspable::ShouldFilterGraspTarget(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent) const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_Graspable::ShouldFilterTarget);
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_Graspable::ShouldFilterGraspTarget);
 
-	const AActor* TargetActor = TargetData.HitResult.GetActor();
+	const AActor* TargetActor = TargetComponent ? TargetComponent->GetOwner() : nullptr;
 
 	// Check if the target actor is valid
 	if (!IsValid(TargetActor))
@@ -35,9 +35,8 @@ bool UGraspFilter_Graspable::ShouldFilterTarget(const FTargetingRequestHandle& T
 		return true;
 	}
 
-	// Retrieve the target component and interface
-	const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
-	const IGraspableComponent* Graspable = TargetComponent ? Cast<IGraspableComponent>(TargetComponent) : nullptr;
+	// Retrieve the target interface
+	const IGraspableComponent* Graspable = Cast<IGraspableComponent>(TargetComponent);
 	
 	// Check if graspable is valid
 	if (!Graspable)
@@ -46,14 +45,14 @@ bool UGraspFilter_Graspable::ShouldFilterTarget(const FTargetingRequestHandle& T
 	}
 
 	// No data
-	const UGraspData* GraspData = Graspable->GetGraspData();
-	if (!GraspData)
+	const FGraspDataRuntime* Runtime = Graspable->GetGraspDataRuntime();
+	if (!Runtime)
 	{
 		return true;
 	}
 
-	// No ability to grant
-	if (!GraspData->GetGraspAbility())
+	// No ability to grant, unless it is soft referenced and will be granted once loaded
+	if (!Runtime->bAbilityLoadPending && !Runtime->GetGraspAbility())
 	{
 		return true;
 	}
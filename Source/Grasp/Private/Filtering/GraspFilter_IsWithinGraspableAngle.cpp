@@ -3,8 +3,10 @@
 
 #include "Filtering/GraspFilter_IsWithinGraspableAngle.h"
 
-#include "GraspComponent.h"
-#include "GraspStatics.h"
+#include "GraspableComponent.h"
+#include "GraspDataRuntime.h"
+#include "Components/PrimitiveComponent.h"
+#include "Types/TargetingSystemTypes.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilter_IsWithinGraspableAngle)
 
@@ -13,25 +15,26 @@ UGraspFilter_IsWithinGraspableAngle::UGraspFilter_IsWithinGraspableAngle(const F
 	: Super(ObjectInitializer)
 {}
 
-bool UGraspFilter_IsWithinGraspableAngle::ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle,
-	const FTargetingDefaultResultData& TargetData) const
+bool UGraspFilter_IsWithinGraspableAngle::ShouldFilterGraspTarget(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent) const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableData::ShouldFilterTarget);
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableAngle::ShouldFilterGraspTarget);
 
-	// Find the source actor
-	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
-	if (!SourceContext || !IsValid(SourceContext->SourceActor))
+	// Requires the source actor
+	if (!Context.SourceActor)
 	{
 		return true;
 	}
 
-	// Get the grasp component from the source actor
-	const TObjectPtr<AActor> SourceActor = SourceContext->SourceActor;
-	const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
-
-	// Query if we can interact with the target based on angle and distance
-	float NormalizedAngle = 0.f;
-	const bool bResult = UGraspStatics::CanInteractWithAngle(SourceActor, TargetComponent, NormalizedAngle);
+	// Get the compiled grasp data from the target
+	const IGraspableComponent* Graspable = TargetComponent ? Cast<IGraspableComponent>(TargetComponent) : nullptr;
+	const FGraspDataRuntime* Runtime = Graspable ? Graspable->GetGraspDataRuntime() : nullptr;
+	if (!Runtime)
+	{
+		return true;
+	}
 
-	return !bResult;
+	// Query if we can interact with the target based on angle
+	return !Runtime->QueryAngle(Context.SourceLocation, TargetComponent->GetComponentLocation(),
+		TargetComponent->GetForwardVector(), Context.NetToleranceIndex);
 }
@@ -3,8 +3,10 @@
 
 #include "Filtering/GraspFilter_IsWithinGraspableData.h"
 
-#include "GraspComponent.h"
-#include "GraspStatics.h"
+#include "GraspableComponent.h"
+#include "GraspDataRuntime.h"
+#include "Components/PrimitiveComponent.h"
+#include "Types/TargetingSystemTypes.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilter_IsWithinGraspableData)
 
@@ -13,26 +15,28 @@ UGraspFilter_IsWithinGraspableData::UGraspFilter_IsWithinGraspableData(const FOb
 	: Super(ObjectInitializer)
 {}
 
-bool UGraspFilter_IsWithinGraspableData::ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle,
-	const FTargetingDefaultResultData& TargetData) const
+bool UGraspFilter_IsWithinGraspableData::ShouldFilterGraspTarget(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent) const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableData::ShouldFilterTarget);
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableData::ShouldFilterGraspTarget);
 
-	// Find the source actor
-	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
-	if (!SourceContext || !IsValid(SourceContext->SourceActor))
+	// Requires the source actor
+	if (!Context.SourceActor)
 	{
 		return true;
 	}
 
-	// Get the grasp component from the source actor
-	const TObjectPtr<AActor> SourceActor = SourceContext->SourceActor;
-	const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
+	// Get the compiled grasp data from the target
+	const IGraspableComponent* Graspable = TargetComponent ? Cast<IGraspableComponent>(TargetComponent) : nullptr;
+	const FGraspDataRuntime* Runtime = Graspable ? Graspable->GetGraspDataRuntime() : nullptr;
+	if (!Runtime)
+	{
+		return true;
+	}
 
 	// Query if we can interact with the target based on angle and distance
-	float NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance = 0.f;
-	const EGraspQueryResult Result = UGraspStatics::CanInteractWith(SourceActor, TargetComponent,
-		NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance);
+	const EGraspQueryResult Result = Runtime->Query(Context.SourceLocation,
+		TargetComponent->GetComponentLocation(), TargetComponent->GetForwardVector(), Context.NetToleranceIndex);
 
 	// Return the result based on the threshold
 	bool bCanInteract;
@@ -3,8 +3,10 @@
 
 #include "Filtering/GraspFilter_IsWithinGraspableHeight.h"
 
-#include "GraspComponent.h"
-#include "GraspStatics.h"
+#include "GraspableComponent.h"
+#include "GraspDataRuntime.h"
+#include "Components/PrimitiveComponent.h"
+#include "Types/TargetingSystemTypes.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilter_IsWithinGraspableHeight)
 
@@ -13,22 +15,25 @@ UGraspFilter_IsWithinGraspableHeight::UGraspFilter_IsWithinGraspableHeight(const
 	: Super(ObjectInitializer)
 {}
 
-bool UGraspFilter_IsWithinGraspableHeight::ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle,
-	const FTargetingDefaultResultData& TargetData) const
+bool UGraspFilter_IsWithinGraspableHeight::ShouldFilterGraspTarget(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent) const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableData::ShouldFilterTarget);
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableHeight::ShouldFilterGraspTarget);
 
-	// Find the source actor
-	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
-	if (!SourceContext || !IsValid(SourceContext->SourceActor))
+	// Requires the source actor
+	if (!Context.SourceActor)
 	{
 		return true;
 	}
 
-	// Get the grasp component from the source actor
-	const TObjectPtr<AActor> SourceActor = SourceContext->SourceActor;
-	const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
+	// Get the compiled grasp data from the target
+	const IGraspableComponent* Graspable = TargetComponent ? Cast<IGraspableComponent>(TargetComponent) : nullptr;
+	const FGraspDataRuntime* Runtime = Graspable ? Graspable->GetGraspDataRuntime() : nullptr;
+	if (!Runtime)
+	{
+		return true;
+	}
 
-	// Query if we can interact with the target based on angle and distance
-	return !UGraspStatics::CanInteractWithHeight(SourceActor, TargetComponent);
+	// Query if we can interact with the target based on height
+	return !Runtime->QueryHeight(Context.SourceLocation, TargetComponent->GetComponentLocation(), Context.NetToleranceIndex);
 }
@@ -3,8 +3,10 @@
 
 #include "Filtering/GraspFilter_IsWithinGraspableRange.h"
 
-#include "GraspComponent.h"
-#include "GraspStatics.h"
+#include "GraspableComponent.h"
+#include "GraspDataRuntime.h"
+#include "Components/PrimitiveComponent.h"
+#include "Types/TargetingSystemTypes.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilter_IsWithinGraspableRange)
 
@@ -13,26 +15,28 @@ UGraspFilter_IsWithinGraspableRange::UGraspFilter_IsWithinGraspableRange(const F
 	: Super(ObjectInitializer)
 {}
 
-bool UGraspFilter_IsWithinGraspableRange::ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle,
-	const FTargetingDefaultResultData& TargetData) const
+bool UGraspFilter_IsWithinGraspableRange::ShouldFilterGraspTarget(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent) const
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableData::ShouldFilterTarget);
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_IsWithinGraspableRange::ShouldFilterGraspTarget);
 
-	// Find the source actor
-	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
-	if (!SourceContext || !IsValid(SourceContext->SourceActor))
+	// Requires the source actor
+	if (!Context.SourceActor)
 	{
 		return true;
 	}
 
-	// Get the grasp component from the source actor
-	const TObjectPtr<AActor> SourceActor = SourceContext->SourceActor;
-	const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
+	// Get the compiled grasp data from the target
+	const IGraspableComponent* Graspable = TargetComponent ? Cast<IGraspableComponent>(TargetComponent) : nullptr;
+	const FGraspDataRuntime* Runtime = Graspable ? Graspable->GetGraspDataRuntime() : nullptr;
+	if (!Runtime)
+	{
+		return true;
+	}
 
-	// Query if we can interact with the target based on angle and distance
-	float NormalizedDistance, NormalizedHighlightDistance = 0.f;
-	const EGraspQueryResult Result = UGraspStatics::CanInteractWithRange(SourceActor, TargetComponent,
-		NormalizedDistance, NormalizedHighlightDistance);
+	// Query if we can interact with the target based on distance
+	const EGraspQueryResult Result = Runtime->QueryRange(Context.SourceLocation,
+		TargetComponent->GetComponentLocation(), Context.NetToleranceIndex);
 
 	// Return the result based on the threshold
 	bool bCanInteract;
@@ -0,0 +1,287 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Filtering/GraspFilter_LineOfSight.h"
+
+#include "GraspStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Targeting/GraspTargetingStatics.h"
+#include "Types/TargetingSystemTypes.h"
+#include "WorldCollision.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspFilter_LineOfSight)
+
+
+UGraspFilter_LineOfSight::UGraspFilter_LineOfSight(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{}
+
+void UGraspFilter_LineOfSight::Execute(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_LineOfSight::Execute);
+	LLM_SCOPE_BYTAG(Grasp);
+
+	// Immediate requests can't wait for async traces, trace synchronously via ShouldFilterGraspTarget()
+	const FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle);
+	UWorld* World = GetSourceContextWorld(TargetingHandle);
+	const FGraspFilterContext Context = FGraspFilterContext::Make(TargetingHandle);
+	if (!IsAsyncTargetingRequest(TargetingHandle) || !Results || !World || !Context.SourceActor)
+	{
+		Super::Execute(TargetingHandle);
+		return;
+	}
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Executing);
+
+	PruneCache(World);
+
+	// Only trace targets that aren't cached, a reused handle invalidates any traces still pending from its last use
+	FPendingTraces& Pending = PendingTraces.FindOrAdd(TargetingHandle);
+	Pending.Serial = ++NextSerial;
+	Pending.NumPending = 0;
+	Pending.Visibility.Reset();
+
+	const FVector TraceStart = GetTraceStart(Context);
+	for (const FTargetingDefaultResultData& TargetData : Results->TargetResults)
+	{
+		const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
+		if (!TargetComponent)
+		{
+			continue;
+		}
+
+		const FVector TraceEnd = GetTraceEnd(TargetComponent);
+		if (const FGraspLineOfSightCacheEntry* Entry = FindCacheEntry(World, Context.SourceActor, TargetComponent, TraceStart, TraceEnd))
+		{
+			Pending.Visibility.Add(FObjectKey(TargetComponent), Entry->bVisible);
+			INC_DWORD_STAT(STAT_GraspLineOfSightCacheHits);
+			continue;
+		}
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(GraspFilter_LineOfSight), bTraceComplex);
+		InitCollisionParams(Context, TargetComponent, Params);
+
+		const FTraceDelegate Delegate = FTraceDelegate::CreateUObject(this, &ThisClass::HandleAsyncTraceComplete,
+			TargetingHandle, Pending.Serial, TWeakObjectPtr<const AActor>(Context.SourceActor),
+			TWeakObjectPtr<const UPrimitiveComponent>(TargetComponent));
+
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, TraceChannel,
+			Params, FCollisionResponseParams::DefaultResponseParam, &Delegate);
+
+		Pending.NumPending++;
+		INC_DWORD_STAT(STAT_GraspLineOfSightTraces);
+	}
+
+	// Everything was cached
+	if (Pending.NumPending == 0)
+	{
+		const TMap<FObjectKey, bool> Visibility = MoveTemp(Pending.Visibility);
+		PendingTraces.Remove(TargetingHandle);
+		FilterFromTraceResults(TargetingHandle, Visibility);
+	}
+}
+
+bool UGraspFilter_LineOfSight::ShouldFilterGraspTarget(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_LineOfSight::ShouldFilterGraspTarget);
+	LLM_SCOPE_BYTAG(Grasp);
+
+	// Requires the source actor
+	const UWorld* World = TargetComponent ? TargetComponent->GetWorld() : nullptr;
+	if (!Context.SourceActor || !World)
+	{
+		return true;
+	}
+
+	const FVector TraceStart = GetTraceStart(Context);
+	const FVector TraceEnd = GetTraceEnd(TargetComponent);
+	if (const FGraspLineOfSightCacheEntry* Entry = FindCacheEntry(World, Context.SourceActor, TargetComponent, TraceStart, TraceEnd))
+	{
+		INC_DWORD_STAT(STAT_GraspLineOfSightCacheHits);
+		return !Entry->bVisible;
+	}
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GraspFilter_LineOfSight), bTraceComplex);
+	InitCollisionParams(Context, TargetComponent, Params);
+
+	const bool bVisible = !World->LineTraceTestByChannel(TraceStart, TraceEnd, TraceChannel, Params);
+	AddCacheEntry(World, Context.SourceActor, TargetComponent, TraceStart, TraceEnd, bVisible);
+	INC_DWORD_STAT(STAT_GraspLineOfSightTraces);
+
+	return !bVisible;
+}
+
+FVector UGraspFilter_LineOfSight::GetTraceStart(const FGraspFilterContext& Context) const
+{
+	// Not all location sources are available for every source actor
+	const FVector Location = UGraspTargetingStatics::GetSourceLocation(Context.TargetingHandle, LocationSource);
+	return Location.IsZero() ? Context.SourceLocation : Location;
+}
+
+FVector UGraspFilter_LineOfSight::GetTraceEnd(const UPrimitiveComponent* TargetComponent)
+{
+	return TargetComponent->Bounds.Origin;
+}
+
+const FGraspLineOfSightCacheEntry* UGraspFilter_LineOfSight::FindCacheEntry(const UWorld* World,
+	const AActor* Interactor, const UPrimitiveComponent* TargetComponent, const FVector& TraceStart,
+	const FVector& TraceEnd) const
+{
+	if (CacheDuration <= 0.f)
+	{
+		return nullptr;
+	}
+
+	const FGraspLineOfSightCacheEntry* Entry = Cache.Find({ FObjectKey(Interactor), FObjectKey(TargetComponent) });
+	if (!Entry || World->TimeSince(Entry->Time) > CacheDuration)
+	{
+		return nullptr;
+	}
+
+	// Moved too far since the trace
+	if (InvalidationDistance > 0.f)
+	{
+		const float InvalidationDistanceSq = FMath::Square(InvalidationDistance);
+		if (FVector::DistSquared(Entry->TraceStart, TraceStart) > InvalidationDistanceSq ||
+			FVector::DistSquared(Entry->TraceEnd, TraceEnd) > InvalidationDistanceSq)
+		{
+			return nullptr;
+		}
+	}
+
+	return Entry;
+}
+
+void UGraspFilter_LineOfSight::AddCacheEntry(const UWorld* World, const AActor* Interactor,
+	const UPrimitiveComponent* TargetComponent, const FVector& TraceStart, const FVector& TraceEnd, bool bVisible) const
+{
+	if (CacheDuration <= 0.f)
+	{
+		return;
+	}
+
+	// The native scan backend never calls Execute(), prune here too
+	PruneCache(World);
+
+	FGraspLineOfSightCacheEntry& Entry = Cache.FindOrAdd({ FObjectKey(Interactor), FObjectKey(TargetComponent) });
+	Entry.TraceStart = TraceStart;
+	Entry.TraceEnd = TraceEnd;
+	Entry.Time = World->GetTimeSeconds();
+	Entry.bVisible = bVisible;
+}
+
+void UGraspFilter_LineOfSight::PruneCache(const UWorld* World) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_LineOfSight::PruneCache);
+
+	// Expired entries are never returned, there is no rush to remove them
+	// Time runs backwards when another world begins play, e.g. PIE
+	const float Now = World->GetTimeSeconds();
+	if (Now >= LastPruneTime && Now - LastPruneTime < FMath::Max(CacheDuration, 1.f))
+	{
+		return;
+	}
+	LastPruneTime = Now;
+
+	for (auto It = Cache.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().Time > CacheDuration || Now < It.Value().Time)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Requests that were ended while their traces were pending
+	for (auto It = PendingTraces.CreateIterator(); It; ++It)
+	{
+		if (!FTargetingSourceContext::Find(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UGraspFilter_LineOfSight::InitCollisionParams(const FGraspFilterContext& Context,
+	const UPrimitiveComponent* TargetComponent, FCollisionQueryParams& OutParams) const
+{
+	UGraspTargetingStatics::InitCollisionParams(Context.TargetingHandle, OutParams, true, false, bTraceComplex);
+
+	// The graspable can't occlude itself
+	OutParams.AddIgnoredActor(TargetComponent->GetOwner());
+}
+
+void UGraspFilter_LineOfSight::HandleAsyncTraceComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum,
+	FTargetingRequestHandle TargetingHandle, uint32 Serial, TWeakObjectPtr<const AActor> Interactor,
+	TWeakObjectPtr<const UPrimitiveComponent> TargetComponent) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_LineOfSight::HandleAsyncTraceComplete);
+
+	const bool bVisible = !InTraceDatum.OutHits.ContainsByPredicate([](const FHitResult& Hit)
+	{
+		return Hit.bBlockingHit;
+	});
+
+	// Cache the result even if the request is gone, the next scan will likely want it
+	const UWorld* World = InTraceDatum.PhysWorld.Get();
+	if (World && Interactor.IsValid() && TargetComponent.IsValid())
+	{
+		AddCacheEntry(World, Interactor.Get(), TargetComponent.Get(), InTraceDatum.Start, InTraceDatum.End, bVisible);
+	}
+
+	// Ended, or the handle has been reused since
+	FPendingTraces* Pending = PendingTraces.Find(TargetingHandle);
+	if (!Pending || Pending->Serial != Serial)
+	{
+		return;
+	}
+
+	// Destroyed components are never added, so they are filtered out
+	if (TargetComponent.IsValid())
+	{
+		Pending->Visibility.Add(FObjectKey(TargetComponent.Get()), bVisible);
+	}
+
+	if (--Pending->NumPending > 0)
+	{
+		return;
+	}
+
+	// Every target has a result now, filter and complete
+	const TMap<FObjectKey, bool> Visibility = MoveTemp(Pending->Visibility);
+	PendingTraces.Remove(TargetingHandle);
+	FilterFromTraceResults(TargetingHandle, Visibility);
+}
+
+void UGraspFilter_LineOfSight::FilterFromTraceResults(const FTargetingRequestHandle& TargetingHandle,
+	const TMap<FObjectKey, bool>& Visibility) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspFilter_LineOfSight::FilterFromTraceResults);
+
+	if (FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle))
+	{
+#if ENABLE_VISUAL_LOG
+		const FGraspFilterContext Context = FGraspFilterContext::Make(TargetingHandle);
+#endif
+		const int32 NumBefore = Results->TargetResults.Num();
+
+		Results->TargetResults.RemoveAll([&](const FTargetingDefaultResultData& TargetData)
+		{
+			const UPrimitiveComponent* TargetComponent = TargetData.HitResult.GetComponent();
+			const bool* bVisible = TargetComponent ? Visibility.Find(FObjectKey(TargetComponent)) : nullptr;
+			const bool bFiltered = !bVisible || !*bVisible;
+#if ENABLE_VISUAL_LOG
+			if (bFiltered)
+			{
+				VisLogRejected(Context, TargetComponent);
+			}
+#endif
+			return bFiltered;
+		});
+
+		RecordFilterCount(TargetingHandle, NumBefore, Results->TargetResults.Num());
+	}
+
+	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+}
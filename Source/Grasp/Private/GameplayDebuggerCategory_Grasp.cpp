@@ -0,0 +1,147 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GameplayDebuggerCategory_Grasp.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "GraspComponent.h"
+#include "GraspStatics.h"
+#include "CanvasItem.h"
+#include "GameFramework/PlayerController.h"
+#include "TargetingSystem/TargetingPreset.h"
+
+
+FGameplayDebuggerCategory_Grasp::FGameplayDebuggerCategory_Grasp()
+{
+	SetDataPackReplication<FRepData>(&DataPack);
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_Grasp::MakeInstance()
+{
+	return MakeShareable(new FGameplayDebuggerCategory_Grasp());
+}
+
+void FGameplayDebuggerCategory_Grasp::FRepData::Serialize(FArchive& Ar)
+{
+	Ar << OwnerName;
+	Ar << ScanRate;
+	Ar << PresetLines;
+	Ar << AbilityLines;
+	Ar << CostHistory;
+}
+
+void FGameplayDebuggerCategory_Grasp::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GameplayDebuggerCategory_Grasp::CollectData);
+
+	DataPack = FRepData();
+
+	// The selected actor, otherwise whoever is debugging
+	UGraspComponent* GC = DebugActor ? UGraspStatics::FindGraspComponentForActor(DebugActor) : nullptr;
+	if (!GC && OwnerPC)
+	{
+		GC = UGraspStatics::FindGraspComponentForActor(OwnerPC);
+	}
+	if (!GC)
+	{
+		return;
+	}
+
+	// Keep the scan diagnostics collecting while we are watching
+	GC->RequestScanDebugInfo();
+
+	DataPack.OwnerName = GetNameSafe(GC->GetOwner());
+	DataPack.ScanRate = GC->GetCachedMaxGraspScanRate();
+	DataPack.CostHistory = GC->ScanCostHistory;
+
+	for (const TPair<FGameplayTag, TObjectPtr<UTargetingPreset>>& Entry : GC->CurrentTargetingPresets)
+	{
+		const bool bInFlight = GC->TargetingRequests.Contains(Entry.Key);
+		const FGraspScanDebugInfo* DebugInfo = GC->ScanDebugInfo.Find(Entry.Key);
+
+		DataPack.PresetLines.Add(FString::Printf(TEXT("{white}%s {grey}%s %s{white} latency: {yellow}%s"),
+			*Entry.Key.ToString(), *GetNameSafe(Entry.Value), bInFlight ? TEXT("{orange}in flight") : TEXT("{green}idle"),
+			DebugInfo ? *FString::Printf(TEXT("%.2fms"), DebugInfo->LastLatencyMs) : TEXT("n/a")));
+
+		if (DebugInfo)
+		{
+			for (const FGraspFilterDebugCount& Count : DebugInfo->FilterCounts)
+			{
+				DataPack.PresetLines.Add(FString::Printf(TEXT("    {grey}%s{white} %d -> {yellow}%d"),
+					*Count.Filter.ToString(), Count.NumBefore, Count.NumAfter));
+			}
+		}
+	}
+
+	for (const TPair<TSubclassOf<UGameplayAbility>, FGraspAbilityData>& Entry : GC->AbilityData)
+	{
+		const FGraspAbilityData& Data = Entry.Value;
+		DataPack.AbilityLines.Add(FString::Printf(TEXT("{white}%s{grey}%s graspables: {yellow}%d{grey} locks: {yellow}%d"),
+			*GetNameSafe(Entry.Key), Data.bPersistent ? TEXT(" (persistent)") : TEXT(""),
+			Data.Graspables.Num(), Data.LockedGraspables.Num()));
+	}
+}
+
+void FGameplayDebuggerCategory_Grasp::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	if (DataPack.OwnerName.IsEmpty())
+	{
+		CanvasContext.Print(TEXT("{red}No GraspComponent for the selected actor"));
+		return;
+	}
+
+	CanvasContext.Printf(TEXT("Owner: {yellow}%s"), *DataPack.OwnerName);
+	CanvasContext.Printf(TEXT("Max scan rate: {yellow}%s"), DataPack.ScanRate > 0.f ?
+		*FString::Printf(TEXT("%.2fs"), DataPack.ScanRate) : TEXT("unthrottled"));
+
+	CanvasContext.Printf(TEXT("Presets: {yellow}%d"), DataPack.PresetLines.Num());
+	for (const FString& Line : DataPack.PresetLines)
+	{
+		CanvasContext.Print(Line);
+	}
+
+	CanvasContext.Printf(TEXT("Abilities: {yellow}%d"), DataPack.AbilityLines.Num());
+	for (const FString& Line : DataPack.AbilityLines)
+	{
+		CanvasContext.Print(Line);
+	}
+
+	DrawCostGraph(CanvasContext);
+}
+
+void FGameplayDebuggerCategory_Grasp::DrawCostGraph(FGameplayDebuggerCanvasContext& CanvasContext) const
+{
+	if (DataPack.CostHistory.Num() == 0)
+	{
+		return;
+	}
+
+	float PeakCost = 0.f;
+	for (const float Cost : DataPack.CostHistory)
+	{
+		PeakCost = FMath::Max(PeakCost, Cost);
+	}
+	CanvasContext.Printf(TEXT("Scan cost, peak {yellow}%.3fms{white} latest {yellow}%.3fms"), PeakCost, DataPack.CostHistory.Last());
+
+	const FVector2D Origin(CanvasContext.CursorX, CanvasContext.CursorY);
+	const FVector2D Size(256.f, 48.f);
+
+	FCanvasTileItem Background(Origin, Size, FLinearColor(0.f, 0.f, 0.f, 0.4f));
+	Background.BlendMode = SE_BLEND_Translucent;
+	CanvasContext.DrawItem(Background, Origin.X, Origin.Y);
+
+	// Scaled to the peak so the shape stays readable regardless of the absolute cost
+	const float BarWidth = Size.X / DataPack.CostHistory.Num();
+	for (int32 i = 0; i < DataPack.CostHistory.Num(); i++)
+	{
+		const float Height = PeakCost > 0.f ? Size.Y * DataPack.CostHistory[i] / PeakCost : 0.f;
+		const FVector2D BarPosition(Origin.X + i * BarWidth, Origin.Y + Size.Y - Height);
+		FCanvasTileItem Bar(BarPosition, FVector2D(FMath::Max(BarWidth - 1.f, 1.f), Height), FLinearColor::Green);
+		CanvasContext.DrawItem(Bar, BarPosition.X, BarPosition.Y);
+	}
+
+	CanvasContext.CursorY += Size.Y + 4.f;
+}
+
+#endif
@@ -0,0 +1,45 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "CoreMinimal.h"
+#include "GameplayDebuggerCategory.h"
+
+class APlayerController;
+
+/**
+ * Scan and grant state of the selected player's UGraspComponent
+ * Collected on the server and replicated by the Gameplay Debugger, so it works against a remote dedicated server
+ */
+class FGameplayDebuggerCategory_Grasp : public FGameplayDebuggerCategory
+{
+public:
+	FGameplayDebuggerCategory_Grasp();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+protected:
+	void DrawCostGraph(FGameplayDebuggerCanvasContext& CanvasContext) const;
+
+	struct FRepData
+	{
+		FString OwnerName;
+		float ScanRate = 0.f;
+		TArray<FString> PresetLines;
+		TArray<FString> AbilityLines;
+
+		/** Game thread cost of recent scan requests in milliseconds, oldest first */
+		TArray<float> CostHistory;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	FRepData DataPack;
+};
+
+#endif
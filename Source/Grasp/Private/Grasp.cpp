@@ -2,17 +2,36 @@
 
 #include "Grasp.h"
 
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "GameplayDebuggerCategory_Grasp.h"
+#endif
+
 #define LOCTEXT_NAMESPACE "FGraspModule"
 
 void FGraspModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+#if WITH_GAMEPLAY_DEBUGGER
+	IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+	GameplayDebuggerModule.RegisterCategory("Grasp", IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_Grasp::MakeInstance),
+		EGameplayDebuggerCategoryState::EnabledInGameAndSimulate);
+	GameplayDebuggerModule.NotifyCategoriesChanged();
+#endif
 }
 
 void FGraspModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+#if WITH_GAMEPLAY_DEBUGGER
+	if (IGameplayDebugger::IsAvailable())
+	{
+		IGameplayDebugger& GameplayDebuggerModule = IGameplayDebugger::Get();
+		GameplayDebuggerModule.UnregisterCategory("Grasp");
+		GameplayDebuggerModule.NotifyCategoriesChanged();
+	}
+#endif
 }
 
 #undef LOCTEXT_NAMESPACE
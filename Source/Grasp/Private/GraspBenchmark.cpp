@@ -0,0 +1,1263 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspBenchmark.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "GraspComponent.h"
+#include "GraspData.h"
+#include "GraspGrantLatency.h"
+#include "GraspStatics.h"
+#include "GraspTypes.h"
+#include "Components/GraspableSphereComponent.h"
+#include "AbilitySystemComponent.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/PackageMapClient.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Math/RandomStream.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/CoreNet.h"
+
+namespace FGraspCVars
+{
+	static int32 BenchBaseline = 0;
+	FAutoConsoleVariableRef CVarBenchBaseline(
+		TEXT("p.Grasp.Bench.Baseline"),
+		BenchBaseline,
+		TEXT("0: Only log benchmark results. 1: Write them to Saved/Grasp/Benchmarks as the new baseline. 2: Compare them against the baseline and fail on regression"),
+		ECVF_Default);
+
+	static float BenchToleranceTime = 0.15f;
+	FAutoConsoleVariableRef CVarBenchToleranceTime(
+		TEXT("p.Grasp.Bench.Tolerance.ScanCost"),
+		BenchToleranceTime,
+		TEXT("Fraction a scan cost or ns/call metric may exceed its baseline by before it is a regression"),
+		ECVF_Default);
+
+	static float BenchToleranceMemory = 0.05f;
+	FAutoConsoleVariableRef CVarBenchToleranceMemory(
+		TEXT("p.Grasp.Bench.Tolerance.Memory"),
+		BenchToleranceMemory,
+		TEXT("Fraction a peak bytes metric may exceed its baseline by before it is a regression"),
+		ECVF_Default);
+
+	static float BenchToleranceRate = 0.05f;
+	FAutoConsoleVariableRef CVarBenchToleranceRate(
+		TEXT("p.Grasp.Bench.Tolerance.GrantRate"),
+		BenchToleranceRate,
+		TEXT("Fraction grants per second may differ from its baseline by before it is a regression"),
+		ECVF_Default);
+
+	static float BenchToleranceBandwidth = 0.1f;
+	FAutoConsoleVariableRef CVarBenchToleranceBandwidth(
+		TEXT("p.Grasp.Bench.Tolerance.Bandwidth"),
+		BenchToleranceBandwidth,
+		TEXT("Fraction a replicated bytes metric may exceed its baseline by before it is a regression"),
+		ECVF_Default);
+
+	static int32 BenchReuseHandles = -1;
+	FAutoConsoleVariableRef CVarBenchReuseHandles(
+		TEXT("p.Grasp.Bench.ReuseHandles"),
+		BenchReuseHandles,
+		TEXT("-1: p.Grasp.Bench.Scan uses the GraspComponent's bReuseTargetingRequestHandles. 0: Disables it for the run. 1: Enables it for the run"),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdBenchStatics(
+		TEXT("p.Grasp.Bench.Statics"),
+		TEXT("Time the UGraspStatics geometry functions in ns/call and check them against golden outputs. Optionally pass the iterations (default 1000000) and the seed (default 1)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : FGraspBenchmark::DefaultIterations;
+			const int32 Seed = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : FGraspBenchmark::DefaultSeed;
+			FGraspBenchmarkReport Report = FGraspBenchmark::RunStatics(World, Iterations, Seed);
+			FGraspBenchmark::Finish(Report, Ar);
+		}));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdBenchScan(
+		TEXT("p.Grasp.Bench.Scan"),
+		TEXT("Walk the local player's pawn through seeded graspables and report scan cost, peak memory and grants per second. Pass the GraspData asset path, then optionally the frames (default 600), the seed (default 1) and the number of graspables (default 200)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const UGraspData* GraspData = Args.Num() > 0 ? LoadObject<UGraspData>(nullptr, *Args[0]) : nullptr;
+			if (!GraspData)
+			{
+				Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Scan: Pass the path of a GraspData asset"));
+				return;
+			}
+
+			const int32 Frames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : FGraspBenchmark::DefaultFrames;
+			const int32 Seed = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : FGraspBenchmark::DefaultSeed;
+			const int32 NumGraspables = Args.Num() > 3 ? FMath::Max(FCString::Atoi(*Args[3]), 1) : FGraspBenchmark::DefaultGraspables;
+			FGraspBenchmark::StartScan(World, GraspData, Frames, Seed, NumGraspables, Ar);
+		}));
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdBenchBandwidth(
+		TEXT("p.Grasp.Bench.Bandwidth"),
+		TEXT("Run on the server. Walk every remote player's pawn through seeded graspables and report the bytes per second Grasp's grants and clears replicate to each. Takes the same arguments as p.Grasp.Bench.Scan"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const UGraspData* GraspData = Args.Num() > 0 ? LoadObject<UGraspData>(nullptr, *Args[0]) : nullptr;
+			if (!GraspData)
+			{
+				Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Bandwidth: Pass the path of a GraspData asset"));
+				return;
+			}
+
+			const int32 Frames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : FGraspBenchmark::DefaultFrames;
+			const int32 Seed = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : FGraspBenchmark::DefaultSeed;
+			const int32 NumGraspables = Args.Num() > 3 ? FMath::Max(FCString::Atoi(*Args[3]), 1) : FGraspBenchmark::DefaultGraspables;
+			FGraspBenchmark::StartBandwidth(World, GraspData, Frames, Seed, NumGraspables, Ar);
+		}));
+}
+
+namespace GraspBenchmark
+{
+	/** Inputs are cycled through by the timed loops, few enough to stay in cache so the functions are measured rather than memory */
+	static constexpr int32 NumInputs = 4096;
+	static constexpr int32 NumGraspables = 64;
+	static constexpr int32 NumGraspData = 4;
+
+	/** Timed results are folded into this so the calls can't be optimized away */
+	static volatile uint32 Sink = 0;
+
+	struct FGeometryInput
+	{
+		FVector InteractorLocation;
+		FVector InteractableLocation;
+		FVector Forward;
+		FRotator Rotation;
+		float Degrees;
+		float Distance;
+		float Angle;
+		bool bCheck2D;
+		bool bHalfCircle;
+	};
+
+	/** Floats are quantized before hashing so checksums survive differences far below what gameplay can observe */
+	static uint32 Quantize(float Value, float Scale)
+	{
+		return static_cast<uint32>(FMath::RoundToInt(Value * Scale));
+	}
+
+	/** @return Nanoseconds per call of Func, which is passed the input index and returns a hashable result */
+	template<typename TFunc>
+	static double TimeNsPerCall(int32 Iterations, int32 Num, TFunc&& Func)
+	{
+		uint32 Result = 0;
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			Result += static_cast<uint32>(Func(i % Num));
+		}
+		const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+		Sink = Sink + Result;
+		return Seconds * 1e9 / Iterations;
+	}
+
+	static AActor* SpawnBenchmarkActor(UWorld* World, const FName Name)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = MakeUniqueObjectName(World->GetCurrentLevel(), AActor::StaticClass(), Name);
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (Actor)
+		{
+			USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+			Actor->SetRootComponent(Root);
+			Root->RegisterComponent();
+		}
+		return Actor;
+	}
+
+	/** @param bScannable If false, the graspable is kept out of any real scans running in this world */
+	static UGraspableSphereComponent* AddBenchmarkGraspable(AActor* Owner, const UGraspData* Data, const FVector& Location, float Yaw,
+		bool bScannable = false)
+	{
+		UGraspableSphereComponent* Graspable = NewObject<UGraspableSphereComponent>(Owner, NAME_None, RF_Transient);
+		Graspable->GraspData = const_cast<UGraspData*>(Data);
+
+		if (!bScannable)
+		{
+			Graspable->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		}
+		Graspable->RegisterComponent();
+		Graspable->SetWorldLocationAndRotation(Location, FRotator(0.f, Yaw, 0.f));
+		return Graspable;
+	}
+
+	static float GetTolerance(EGraspBenchmarkMetricType Type)
+	{
+		switch (Type)
+		{
+		case EGraspBenchmarkMetricType::Time: return FGraspCVars::BenchToleranceTime;
+		case EGraspBenchmarkMetricType::Memory: return FGraspCVars::BenchToleranceMemory;
+		case EGraspBenchmarkMetricType::Rate: return FGraspCVars::BenchToleranceRate;
+		case EGraspBenchmarkMetricType::Bandwidth: return FGraspCVars::BenchToleranceBandwidth;
+		}
+		return 0.f;
+	}
+
+	static UGraspData* MakeBenchmarkGraspData(float Angle, float Distance, float HighlightDistance, float HeightAbove, float HeightBelow)
+	{
+		UGraspData* Data = NewObject<UGraspData>(GetTransientPackage(), NAME_None, RF_Transient);
+		Data->MaxGraspAngle = Angle;
+		Data->MaxGraspDistance = Distance;
+		Data->MaxHighlightDistance = HighlightDistance;
+		Data->MaxHeightAbove = HeightAbove;
+		Data->MaxHeightBelow = HeightBelow;
+
+		// Results must not depend on the net mode of the world the benchmark runs in
+		Data->AuthNetToleranceAnglePct = 0.f;
+		Data->AuthNetToleranceDistancePct = 0.f;
+		return Data;
+	}
+}
+
+void FGraspBenchmarkReport::Log(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Grasp benchmark %s (seed %d, %s)"), *Name, Seed, *Config);
+	for (const FGraspBenchmarkMetric& Metric : Metrics)
+	{
+		Ar.Logf(TEXT("  %-40s %12.2f %s"), *Metric.Name, Metric.Value, *Metric.Unit);
+	}
+	for (const TPair<FString, uint32>& Checksum : Checksums)
+	{
+		Ar.Logf(TEXT("  %-40s %08x"), *Checksum.Key, Checksum.Value);
+	}
+	for (const FString& Failure : Failures)
+	{
+		Ar.Logf(ELogVerbosity::Error, TEXT("  FAILED: %s"), *Failure);
+	}
+
+	if (HasPassed())
+	{
+		Ar.Logf(TEXT("Grasp benchmark %s passed"), *Name);
+	}
+	else
+	{
+		Ar.Logf(ELogVerbosity::Error, TEXT("Grasp benchmark %s failed %d checks"), *Name, Failures.Num());
+	}
+}
+
+FString FGraspBenchmarkReport::GetBaselineFilename() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("Grasp") / TEXT("Benchmarks") / Name + TEXT(".json");
+}
+
+bool FGraspBenchmarkReport::WriteBaseline(const FString& Filename) const
+{
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Version"), BaselineVersion);
+	Root->SetStringField(TEXT("Name"), Name);
+	Root->SetNumberField(TEXT("Seed"), Seed);
+	Root->SetStringField(TEXT("Config"), Config);
+
+	const TSharedRef<FJsonObject> MetricsObject = MakeShared<FJsonObject>();
+	for (const FGraspBenchmarkMetric& Metric : Metrics)
+	{
+		const TSharedRef<FJsonObject> MetricObject = MakeShared<FJsonObject>();
+		MetricObject->SetNumberField(TEXT("Value"), Metric.Value);
+		MetricObject->SetStringField(TEXT("Unit"), Metric.Unit);
+		MetricsObject->SetObjectField(Metric.Name, MetricObject);
+	}
+	Root->SetObjectField(TEXT("Metrics"), MetricsObject);
+
+	// Hex strings, a uint32 is exact in a json number but harder to compare by eye
+	const TSharedRef<FJsonObject> ChecksumsObject = MakeShared<FJsonObject>();
+	for (const TPair<FString, uint32>& Checksum : Checksums)
+	{
+		ChecksumsObject->SetStringField(Checksum.Key, FString::Printf(TEXT("%08x"), Checksum.Value));
+	}
+	Root->SetObjectField(TEXT("Checksums"), ChecksumsObject);
+
+	FString Json;
+	if (!FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json)))
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringToFile(Json, *Filename);
+}
+
+bool FGraspBenchmarkReport::CompareBaseline(const FString& Filename, FOutputDevice& Ar)
+{
+	FString Json;
+	TSharedPtr<FJsonObject> Root;
+	if (!FFileHelper::LoadFileToString(Json, *Filename) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		Failures.Add(FString::Printf(TEXT("Could not read the baseline %s, write one with p.Grasp.Bench.Baseline 1"), *Filename));
+		return false;
+	}
+
+	const int32 Version = static_cast<int32>(Root->GetNumberField(TEXT("Version")));
+	const int32 BaselineSeed = static_cast<int32>(Root->GetNumberField(TEXT("Seed")));
+	const FString BaselineConfig = Root->GetStringField(TEXT("Config"));
+	if (Version != BaselineVersion || BaselineSeed != Seed || BaselineConfig != Config)
+	{
+		Failures.Add(FString::Printf(TEXT("Baseline %s is version %d with seed %d (%s), this run is version %d with seed %d (%s)"),
+			*Filename, Version, BaselineSeed, *BaselineConfig, BaselineVersion, Seed, *Config));
+		return false;
+	}
+
+	Ar.Logf(TEXT("Grasp benchmark %s compared to %s"), *Name, *Filename);
+
+	const TSharedPtr<FJsonObject>* BaselineMetrics = nullptr;
+	Root->TryGetObjectField(TEXT("Metrics"), BaselineMetrics);
+	for (const FGraspBenchmarkMetric& Metric : Metrics)
+	{
+		const TSharedPtr<FJsonObject>* BaselineMetric = nullptr;
+		double BaselineValue = 0.0;
+		if (!BaselineMetrics || !(*BaselineMetrics)->TryGetObjectField(Metric.Name, BaselineMetric) ||
+			!(*BaselineMetric)->TryGetNumberField(TEXT("Value"), BaselineValue))
+		{
+			Ar.Logf(ELogVerbosity::Warning, TEXT("  %-40s is not in the baseline"), *Metric.Name);
+			continue;
+		}
+
+		// Relative change, anything from nothing is treated as doubling
+		const double Change = BaselineValue != 0.0 ? (Metric.Value - BaselineValue) / BaselineValue : (Metric.Value != 0.0 ? 1.0 : 0.0);
+		const float Tolerance = GraspBenchmark::GetTolerance(Metric.Type);
+		const bool bRegressed = Metric.Type == EGraspBenchmarkMetricType::Rate ? FMath::Abs(Change) > Tolerance : Change > Tolerance;
+
+		Ar.Logf(TEXT("  %-40s %12.2f -> %12.2f %s (%+.1f%%)%s"), *Metric.Name, BaselineValue, Metric.Value, *Metric.Unit,
+			Change * 100.0, bRegressed ? TEXT(" REGRESSED") : TEXT(""));
+		if (bRegressed)
+		{
+			Failures.Add(FString::Printf(TEXT("%s changed %+.1f%% from the baseline, the tolerance is %.1f%%"),
+				*Metric.Name, Change * 100.0, Tolerance * 100.f));
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* BaselineChecksums = nullptr;
+	Root->TryGetObjectField(TEXT("Checksums"), BaselineChecksums);
+	for (const TPair<FString, uint32>& Checksum : Checksums)
+	{
+		FString BaselineChecksum;
+		if (BaselineChecksums && (*BaselineChecksums)->TryGetStringField(Checksum.Key, BaselineChecksum) &&
+			BaselineChecksum != FString::Printf(TEXT("%08x"), Checksum.Value))
+		{
+			Failures.Add(FString::Printf(TEXT("%s outputs changed, the checksum was %s and is now %08x"),
+				*Checksum.Key, *BaselineChecksum, Checksum.Value));
+		}
+	}
+
+	return true;
+}
+
+void FGraspBenchmark::Finish(FGraspBenchmarkReport& Report, FOutputDevice& Ar)
+{
+	const FString Filename = Report.GetBaselineFilename();
+	if (FGraspCVars::BenchBaseline == 1)
+	{
+		// A baseline recorded from a failing run would hide the failure from every comparison after it
+		if (!Report.HasPassed())
+		{
+			Ar.Logf(ELogVerbosity::Warning, TEXT("Grasp benchmark %s failed, not writing the baseline"), *Report.Name);
+		}
+		else if (Report.WriteBaseline(Filename))
+		{
+			Ar.Logf(TEXT("Grasp benchmark %s wrote the baseline %s"), *Report.Name, *Filename);
+		}
+		else
+		{
+			Ar.Logf(ELogVerbosity::Error, TEXT("Grasp benchmark %s failed to write the baseline %s"), *Report.Name, *Filename);
+		}
+	}
+	else if (FGraspCVars::BenchBaseline == 2)
+	{
+		Report.CompareBaseline(Filename, Ar);
+	}
+
+	Report.Log(Ar);
+}
+
+FGraspBenchmarkReport FGraspBenchmark::RunStatics(UWorld* World, int32 Iterations, int32 Seed)
+{
+	using namespace GraspBenchmark;
+
+	FGraspBenchmarkReport Report;
+	Report.Name = TEXT("Statics");
+	Report.Seed = Seed;
+	Report.Config = FString::Printf(TEXT("Iterations=%d"), Iterations);
+
+	// Golden outputs
+
+	struct FCardinalCase { float Angle; EGraspCardinal_8Way Expected; };
+	static const FCardinalCase CardinalCases[] = {
+		{ 0.f, EGraspCardinal_8Way::Forward },
+		{ 22.5f, EGraspCardinal_8Way::Forward },
+		{ 22.6f, EGraspCardinal_8Way::ForwardRight },
+		{ -45.f, EGraspCardinal_8Way::ForwardLeft },
+		{ 67.5f, EGraspCardinal_8Way::ForwardRight },
+		{ 90.f, EGraspCardinal_8Way::Right },
+		{ -90.f, EGraspCardinal_8Way::Left },
+		{ 112.5f, EGraspCardinal_8Way::BackwardRight },
+		{ -135.f, EGraspCardinal_8Way::BackwardLeft },
+		{ 157.5f, EGraspCardinal_8Way::Backward },
+		{ 180.f, EGraspCardinal_8Way::Backward },
+		{ -180.f, EGraspCardinal_8Way::Backward },
+	};
+	for (const FCardinalCase& Case : CardinalCases)
+	{
+		const EGraspCardinal_8Way Result = UGraspStatics::GetCardinalDirectionFromAngle_8Way(Case.Angle);
+		if (Result != Case.Expected)
+		{
+			Report.Failures.Add(FString::Printf(TEXT("GetCardinalDirectionFromAngle_8Way(%.1f) returned %s, expected %s"), Case.Angle,
+				*UEnum::GetValueAsString(Result), *UEnum::GetValueAsString(Case.Expected)));
+		}
+	}
+
+	struct FCardinalAngleCase { FVector Direction; float Yaw; float Expected; };
+	static const FCardinalAngleCase CardinalAngleCases[] = {
+		{ FVector(1.f, 0.f, 0.f), 0.f, 0.f },
+		{ FVector(0.f, 1.f, 0.f), 0.f, 90.f },
+		{ FVector(0.f, -1.f, 0.f), 0.f, -90.f },
+		{ FVector(-1.f, 0.f, 0.f), 0.f, 180.f },
+		{ FVector(1.f, 1.f, 0.f), 0.f, 45.f },
+		{ FVector(1.f, -1.f, 0.f), 0.f, -45.f },
+		{ FVector(0.f, 1.f, 0.f), 90.f, 0.f },
+		{ FVector(5.f, 0.f, 5.f), 0.f, 0.f },
+		{ FVector::ZeroVector, 0.f, 0.f },
+	};
+	for (const FCardinalAngleCase& Case : CardinalAngleCases)
+	{
+		const float Result = UGraspStatics::CalculateCardinalAngle(Case.Direction, FRotator(0.f, Case.Yaw, 0.f));
+		if (!FMath::IsNearlyEqual(Result, Case.Expected, 0.01f))
+		{
+			Report.Failures.Add(FString::Printf(TEXT("CalculateCardinalAngle(%s, Yaw %.1f) returned %.3f, expected %.3f"),
+				*Case.Direction.ToString(), Case.Yaw, Result, Case.Expected));
+		}
+	}
+
+	struct FDistanceCase { FVector Interactable; float Distance; bool bCheck2D; bool bExpected; };
+	static const FDistanceCase DistanceCases[] = {
+		{ FVector(100.f, 0.f, 0.f), 100.f, true, true },
+		{ FVector(100.5f, 0.f, 0.f), 100.f, true, false },
+		{ FVector(100.f, 0.f, 50.f), 100.f, true, true },
+		{ FVector(100.f, 0.f, 50.f), 100.f, false, false },
+		{ FVector(60.f, 80.f, 0.f), 100.f, false, true },
+		{ FVector::ZeroVector, 0.f, true, true },
+	};
+	for (const FDistanceCase& Case : DistanceCases)
+	{
+		if (UGraspStatics::IsWithinInteractDistance(FVector::ZeroVector, Case.Interactable, Case.Distance, Case.bCheck2D) != Case.bExpected)
+		{
+			Report.Failures.Add(FString::Printf(TEXT("IsWithinInteractDistance(%s, %.1f, 2D %d) expected %d"),
+				*Case.Interactable.ToString(), Case.Distance, Case.bCheck2D, Case.bExpected));
+		}
+	}
+
+	// Interactor at the origin facing +X
+	struct FAngleCase { FVector Interactable; float Degrees; bool bCheck2D; bool bHalfCircle; bool bExpected; };
+	static const FAngleCase AngleCases[] = {
+		{ FVector(100.f, 0.f, 0.f), 90.f, true, false, true },
+		{ FVector(100.f, 90.f, 0.f), 90.f, true, false, true },
+		{ FVector(100.f, 110.f, 0.f), 90.f, true, false, false },
+		{ FVector(-100.f, 10.f, 0.f), 360.f, true, false, true },
+		{ FVector(-100.f, 0.f, 0.f), 270.f, true, false, false },
+		{ FVector(10.f, 100.f, 0.f), 90.f, true, true, true },
+		{ FVector(-10.f, 100.f, 0.f), 90.f, true, true, false },
+		{ FVector(100.f, 0.f, 100.f), 60.f, true, false, true },
+		{ FVector(100.f, 0.f, 100.f), 60.f, false, false, false },
+	};
+	for (const FAngleCase& Case : AngleCases)
+	{
+		if (UGraspStatics::IsWithinInteractAngle(FVector::ZeroVector, Case.Interactable, FVector::ForwardVector,
+			Case.Degrees, Case.bCheck2D, Case.bHalfCircle) != Case.bExpected)
+		{
+			Report.Failures.Add(FString::Printf(TEXT("IsWithinInteractAngle(%s, %.1f, 2D %d, HalfCircle %d) expected %d"),
+				*Case.Interactable.ToString(), Case.Degrees, Case.bCheck2D, Case.bHalfCircle, Case.bExpected));
+		}
+	}
+
+	// Randomized inputs
+
+	FRandomStream Stream(Seed);
+	TArray<FGeometryInput> Inputs;
+	Inputs.SetNumUninitialized(NumInputs);
+	for (FGeometryInput& Input : Inputs)
+	{
+		Input.InteractorLocation = FVector(Stream.FRandRange(-1000.f, 1000.f), Stream.FRandRange(-1000.f, 1000.f), Stream.FRandRange(-200.f, 200.f));
+		Input.InteractableLocation = FVector(Stream.FRandRange(-1000.f, 1000.f), Stream.FRandRange(-1000.f, 1000.f), Stream.FRandRange(-200.f, 200.f));
+		Input.Rotation = FRotator(0.f, Stream.FRandRange(-180.f, 180.f), 0.f);
+		Input.Forward = Input.Rotation.Vector();
+		Input.Degrees = Stream.FRandRange(0.f, 360.f);
+		Input.Distance = Stream.FRandRange(0.f, 1500.f);
+		Input.Angle = Stream.FRandRange(-180.f, 180.f);
+		Input.bCheck2D = Stream.FRand() < 0.75f;
+		Input.bHalfCircle = Stream.FRand() < 0.25f;
+	}
+
+	const auto AngleFunc = [&Inputs](int32 i)
+	{
+		const FGeometryInput& Input = Inputs[i];
+		return UGraspStatics::IsWithinInteractAngle(Input.InteractorLocation, Input.InteractableLocation,
+			Input.Forward, Input.Degrees, Input.bCheck2D, Input.bHalfCircle);
+	};
+	const auto DistanceFunc = [&Inputs](int32 i)
+	{
+		const FGeometryInput& Input = Inputs[i];
+		return UGraspStatics::IsWithinInteractDistance(Input.InteractorLocation, Input.InteractableLocation, Input.Distance, Input.bCheck2D);
+	};
+	const auto CardinalAngleFunc = [&Inputs](int32 i)
+	{
+		const FGeometryInput& Input = Inputs[i];
+		return Quantize(UGraspStatics::CalculateCardinalAngle(Input.InteractableLocation - Input.InteractorLocation, Input.Rotation), 100.f);
+	};
+	const auto CardinalFunc = [&Inputs](int32 i)
+	{
+		return static_cast<uint32>(UGraspStatics::GetCardinalDirectionFromAngle_8Way(Inputs[i].Angle));
+	};
+
+	const auto AddFunction = [&Report, Iterations](const TCHAR* FuncName, const auto& Func, int32 Num)
+	{
+		uint32 Checksum = 0;
+		for (int32 i = 0; i < Num; i++)
+		{
+			Checksum = HashCombine(Checksum, GetTypeHash(static_cast<uint32>(Func(i))));
+		}
+		Report.Checksums.Add(FuncName, Checksum);
+		Report.AddMetric(FuncName, TimeNsPerCall(Iterations, Num, Func), TEXT("ns/call"), EGraspBenchmarkMetricType::Time);
+	};
+
+	AddFunction(TEXT("IsWithinInteractAngle"), AngleFunc, NumInputs);
+	AddFunction(TEXT("IsWithinInteractDistance"), DistanceFunc, NumInputs);
+	AddFunction(TEXT("CalculateCardinalAngle"), CardinalAngleFunc, NumInputs);
+	AddFunction(TEXT("GetCardinalDirectionFromAngle_8Way"), CardinalFunc, NumInputs);
+
+	// The component queries need an interactor and graspables in the world
+	if (!IsValid(World))
+	{
+		Report.Failures.Add(TEXT("CanInteractWith and CanInteractWithRange need a world"));
+		return Report;
+	}
+
+	AActor* Interactor = SpawnBenchmarkActor(World, TEXT("GraspBenchmarkInteractor"));
+	AActor* GraspableOwner = SpawnBenchmarkActor(World, TEXT("GraspBenchmarkGraspables"));
+	if (!Interactor || !GraspableOwner)
+	{
+		Report.Failures.Add(TEXT("Failed to spawn the interactor or graspables"));
+		return Report;
+	}
+
+	UGraspData* GoldenData = MakeBenchmarkGraspData(90.f, 200.f, 400.f, 50.f, 50.f);
+
+	struct FQueryCase { FVector Location; float Yaw; EGraspQueryResult Expected; EGraspQueryResult ExpectedRange; };
+	static const FQueryCase QueryCases[] = {
+		{ FVector(100.f, 0.f, 0.f), 180.f, EGraspQueryResult::Interact, EGraspQueryResult::Interact },
+		{ FVector(100.f, 0.f, 0.f), 0.f, EGraspQueryResult::None, EGraspQueryResult::Interact },
+		{ FVector(300.f, 0.f, 0.f), 180.f, EGraspQueryResult::Highlight, EGraspQueryResult::Highlight },
+		{ FVector(500.f, 0.f, 0.f), 180.f, EGraspQueryResult::None, EGraspQueryResult::None },
+		{ FVector(100.f, 0.f, 80.f), 180.f, EGraspQueryResult::None, EGraspQueryResult::Interact },
+		{ FVector(100.f, 0.f, -30.f), 180.f, EGraspQueryResult::Interact, EGraspQueryResult::Interact },
+	};
+	for (const FQueryCase& Case : QueryCases)
+	{
+		const UGraspableSphereComponent* Graspable = AddBenchmarkGraspable(GraspableOwner, GoldenData, Case.Location, Case.Yaw);
+
+		float NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance;
+		const EGraspQueryResult Result = UGraspStatics::CanInteractWith(Interactor, Graspable,
+			NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance);
+		if (Result != Case.Expected)
+		{
+			Report.Failures.Add(FString::Printf(TEXT("CanInteractWith(%s, Yaw %.1f) returned %s, expected %s"), *Case.Location.ToString(),
+				Case.Yaw, *UEnum::GetValueAsString(Result), *UEnum::GetValueAsString(Case.Expected)));
+		}
+
+		const EGraspQueryResult RangeResult = UGraspStatics::CanInteractWithRange(Interactor, Graspable,
+			NormalizedDistance, NormalizedHighlightDistance);
+		if (RangeResult != Case.ExpectedRange)
+		{
+			Report.Failures.Add(FString::Printf(TEXT("CanInteractWithRange(%s) returned %s, expected %s"), *Case.Location.ToString(),
+				*UEnum::GetValueAsString(RangeResult), *UEnum::GetValueAsString(Case.ExpectedRange)));
+		}
+	}
+
+	// Randomized graspables around the interactor, sharing a few randomized data
+	TArray<UGraspData*> Datas;
+	for (int32 i = 0; i < NumGraspData; i++)
+	{
+		Datas.Add(MakeBenchmarkGraspData(Stream.FRandRange(30.f, 360.f), Stream.FRandRange(100.f, 400.f),
+			Stream.FRand() < 0.5f ? Stream.FRandRange(400.f, 800.f) : 0.f, Stream.FRandRange(0.f, 100.f), Stream.FRandRange(0.f, 100.f)));
+	}
+
+	TArray<const UPrimitiveComponent*> Graspables;
+	for (int32 i = 0; i < NumGraspables; i++)
+	{
+		const FVector Location(Stream.FRandRange(-600.f, 600.f), Stream.FRandRange(-600.f, 600.f), Stream.FRandRange(-100.f, 100.f));
+		Graspables.Add(AddBenchmarkGraspable(GraspableOwner, Datas[i % NumGraspData], Location, Stream.FRandRange(-180.f, 180.f)));
+	}
+
+	const auto QueryFunc = [Interactor, &Graspables](int32 i)
+	{
+		float NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance;
+		const EGraspQueryResult Result = UGraspStatics::CanInteractWith(Interactor, Graspables[i],
+			NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance);
+		return HashCombine(static_cast<uint32>(Result), Quantize(NormalizedDistance + NormalizedHighlightDistance, 1000.f));
+	};
+	const auto RangeFunc = [Interactor, &Graspables](int32 i)
+	{
+		float NormalizedDistance, NormalizedHighlightDistance;
+		const EGraspQueryResult Result = UGraspStatics::CanInteractWithRange(Interactor, Graspables[i],
+			NormalizedDistance, NormalizedHighlightDistance);
+		return HashCombine(static_cast<uint32>(Result), Quantize(NormalizedDistance + NormalizedHighlightDistance, 1000.f));
+	};
+
+	AddFunction(TEXT("CanInteractWith"), QueryFunc, NumGraspables);
+	AddFunction(TEXT("CanInteractWithRange"), RangeFunc, NumGraspables);
+
+	Interactor->Destroy();
+	GraspableOwner->Destroy();
+
+	return Report;
+}
+
+namespace GraspBenchmark
+{
+	/** The path advances by world time, which is fixed to this step for the run so scan timers fire on the same frames every run */
+	static constexpr float ScanPathSpeed = 400.f;
+	static constexpr float ScanPathStepSeconds = 1.f / 30.f;
+
+	/** Half size of the square the graspables and waypoints are placed in, centered on the pawn */
+	static constexpr float ScanAreaExtent = 1500.f;
+	static constexpr int32 NumScanWaypoints = 16;
+
+	/** Forces a fixed frame time while a path benchmark runs, restoring the previous frame time when destroyed */
+	struct FFixedTimeStep
+	{
+		bool bEnabled = false;
+		bool bWasFixed = false;
+		double PreviousDeltaTime = 0.0;
+
+		void Enable()
+		{
+			bEnabled = true;
+			bWasFixed = FApp::UseFixedTimeStep();
+			PreviousDeltaTime = FApp::GetFixedDeltaTime();
+			FApp::SetUseFixedTimeStep(true);
+			FApp::SetFixedDeltaTime(ScanPathStepSeconds);
+		}
+
+		~FFixedTimeStep()
+		{
+			if (bEnabled)
+			{
+				FApp::SetUseFixedTimeStep(bWasFixed);
+				FApp::SetFixedDeltaTime(PreviousDeltaTime);
+			}
+		}
+	};
+
+	/** Records grant latency while a path benchmark runs, restoring p.Grasp.Latency.Enable when destroyed */
+	struct FRecordGrantLatency
+	{
+		bool bEnabled = false;
+		bool bWasEnabled = false;
+
+		void Enable()
+		{
+			bEnabled = true;
+			bWasEnabled = FGraspGrantLatency::IsEnabled();
+			FGraspGrantLatency::SetEnabled(true);
+		}
+
+		~FRecordGrantLatency()
+		{
+			if (bEnabled)
+			{
+				FGraspGrantLatency::SetEnabled(bWasEnabled);
+			}
+		}
+	};
+
+	/** Overrides UGraspComponent::bReuseTargetingRequestHandles while the scan benchmark runs, restoring it when destroyed */
+	struct FReuseTargetingRequestHandles
+	{
+		TWeakObjectPtr<UGraspComponent> GraspComponent;
+		bool bWasReused = false;
+
+		void Enable(UGraspComponent* GC, bool bReuse)
+		{
+			GraspComponent = GC;
+			bWasReused = GC->bReuseTargetingRequestHandles;
+			GC->bReuseTargetingRequestHandles = bReuse;
+		}
+
+		~FReuseTargetingRequestHandles()
+		{
+			if (UGraspComponent* GC = GraspComponent.Get())
+			{
+				GC->bReuseTargetingRequestHandles = bWasReused;
+			}
+		}
+	};
+
+	/** Walks a pawn towards seeded waypoints at a fixed speed in world time */
+	struct FScanBenchmarkPath
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		FTransform StartTransform;
+		TArray<FVector> Waypoints;
+		int32 NextWaypoint = 0;
+
+		/** Our own location is used so movement components can't change the path */
+		FVector PathLocation = FVector::ZeroVector;
+
+		/** Place the graspables around the pawn and generate its waypoints */
+		void Init(APawn* InPawn, AActor* GraspableOwner, const UGraspData* GraspData, int32 NumGraspables, FRandomStream& Stream)
+		{
+			Pawn = InPawn;
+			StartTransform = InPawn->GetActorTransform();
+			PathLocation = StartTransform.GetLocation();
+
+			// Placement and path are relative to the pawn, the same seed produces the same layout anywhere in the map
+			const FVector Origin = PathLocation;
+			const auto RandomPoint = [&Stream, &Origin]
+			{
+				return Origin + FVector(Stream.FRandRange(-ScanAreaExtent, ScanAreaExtent), Stream.FRandRange(-ScanAreaExtent, ScanAreaExtent), 0.f);
+			};
+
+			for (int32 i = 0; i < NumGraspables; i++)
+			{
+				const FVector Location = RandomPoint();
+				AddBenchmarkGraspable(GraspableOwner, GraspData, Location, Stream.FRandRange(-180.f, 180.f), true);
+			}
+
+			for (int32 i = 0; i < NumScanWaypoints; i++)
+			{
+				Waypoints.Add(RandomPoint());
+			}
+		}
+
+		/** @return False if the pawn was destroyed */
+		bool Step()
+		{
+			APawn* PawnPtr = Pawn.Get();
+			if (!PawnPtr)
+			{
+				return false;
+			}
+
+			const float Step = ScanPathSpeed * PawnPtr->GetWorld()->GetDeltaSeconds();
+			const FVector ToWaypoint = (Waypoints[NextWaypoint] - PathLocation) * FVector(1.f, 1.f, 0.f);
+			const float Yaw = ToWaypoint.IsNearlyZero() ? PawnPtr->GetActorRotation().Yaw : ToWaypoint.Rotation().Yaw;
+			if (ToWaypoint.Size() <= Step)
+			{
+				PathLocation = Waypoints[NextWaypoint];
+				NextWaypoint = (NextWaypoint + 1) % Waypoints.Num();
+			}
+			else
+			{
+				PathLocation += ToWaypoint.GetSafeNormal() * Step;
+			}
+
+			PawnPtr->SetActorLocationAndRotation(PathLocation, FRotator(0.f, Yaw, 0.f), false, nullptr, ETeleportType::TeleportPhysics);
+			if (AController* Controller = PawnPtr->GetController())
+			{
+				Controller->SetControlRotation(FRotator(0.f, Yaw, 0.f));
+			}
+			return true;
+		}
+
+		/** Return the pawn to where it started and restart the path */
+		void Reset()
+		{
+			NextWaypoint = 0;
+			PathLocation = StartTransform.GetLocation();
+			if (APawn* PawnPtr = Pawn.Get())
+			{
+				PawnPtr->SetActorTransform(StartTransform, false, nullptr, ETeleportType::TeleportPhysics);
+			}
+		}
+	};
+
+	/** Grant latency percentiles recorded in the map since the benchmark started, see FGraspGrantLatency */
+	static void AddGrantLatencyMetrics(FGraspBenchmarkReport& Report, const FString& MapName, bool bReplication)
+	{
+		const FGraspMapGrantLatency* Latency = FGraspGrantLatency::Get().Find(MapName);
+		if (!Latency || Latency->Total.Num() == 0)
+		{
+			return;
+		}
+
+		Report.AddMetric(TEXT("GrantLatencyP50"), Latency->Total.GetPercentile(0.5f) * 1000.0, TEXT("ms"), EGraspBenchmarkMetricType::Time);
+		Report.AddMetric(TEXT("GrantLatencyP95"), Latency->Total.GetPercentile(0.95f) * 1000.0, TEXT("ms"), EGraspBenchmarkMetricType::Time);
+		if (bReplication)
+		{
+			Report.AddMetric(TEXT("ReplicationLatencyP50"), Latency->Replication.GetPercentile(0.5f) * 1000.0, TEXT("ms"),
+				EGraspBenchmarkMetricType::Time);
+		}
+	}
+
+	/** p.Grasp.Bench.Scan in progress */
+	struct FScanBenchmark
+	{
+		FFixedTimeStep FixedTimeStep;
+		FRecordGrantLatency RecordGrantLatency;
+		FReuseTargetingRequestHandles ReuseTargetingRequestHandles;
+		FScanBenchmarkPath Path;
+		TWeakObjectPtr<UGraspComponent> GraspComponent;
+		TWeakObjectPtr<AActor> GraspableOwner;
+		FString MapName;
+
+		int32 Frame = 0;
+		int32 NumFrames = 0;
+
+		double StartScanCost = 0.0;
+		int32 StartNumScanCosts = 0;
+		int32 StartNumGrants = 0;
+		double StartWorldTime = 0.0;
+		SIZE_T PeakMemory = 0;
+
+		FGraspBenchmarkReport Report;
+		FGraspBenchmark::FOnFinished OnFinished;
+
+		/** @return False once the benchmark is complete */
+		bool Tick()
+		{
+			UGraspComponent* GC = GraspComponent.Get();
+			if (!GC || !Path.Step())
+			{
+				Report.Failures.Add(TEXT("The pawn or its GraspComponent was destroyed"));
+				return false;
+			}
+
+			// Keeps the scan costs recording
+			GC->RequestScanDebugInfo();
+
+			const SIZE_T Memory = GC->GetGraspMemoryUsage().GetTotal() + FGraspTargetingRequestData::GetStoreAllocatedSize() +
+				FGraspSelectionContext::GetStoreAllocatedSize();
+			PeakMemory = FMath::Max(PeakMemory, Memory);
+
+			return ++Frame < NumFrames;
+		}
+
+		void Finish()
+		{
+			if (const UGraspComponent* GC = GraspComponent.Get())
+			{
+				const int32 NumScans = GC->GetNumScanDebugCosts() - StartNumScanCosts;
+				if (NumScans == 0)
+				{
+					Report.Failures.Add(TEXT("No scans were requested, is Grasp initialized for the local player?"));
+				}
+
+				// World time, the same clock the path and the scan timers run on
+				const double ScanCost = NumScans > 0 ? (GC->GetTotalScanDebugCost() - StartScanCost) / NumScans : 0.0;
+				const double Seconds = FMath::Max(GC->GetWorld()->GetTimeSeconds() - StartWorldTime, UE_KINDA_SMALL_NUMBER);
+				const double GrantsPerSecond = (GC->GetNumGraspAbilitiesGranted() - StartNumGrants) / Seconds;
+				Report.AddMetric(TEXT("ScanCost"), ScanCost, TEXT("ms/request"), EGraspBenchmarkMetricType::Time);
+				Report.AddMetric(TEXT("GraspMemoryPeak"), static_cast<double>(PeakMemory), TEXT("bytes"), EGraspBenchmarkMetricType::Memory);
+				Report.AddMetric(TEXT("GrantsPerSecond"), GrantsPerSecond, TEXT("grants/s"), EGraspBenchmarkMetricType::Rate);
+				AddGrantLatencyMetrics(Report, MapName, false);
+			}
+
+			Path.Reset();
+			if (AActor* Owner = GraspableOwner.Get())
+			{
+				Owner->Destroy();
+			}
+
+			FGraspBenchmark::Finish(Report, *GLog);
+			if (OnFinished)
+			{
+				OnFinished(Report);
+			}
+		}
+	};
+
+	/** Bits each item in a fast array delta is prefixed with, and all that is sent for a removed item */
+	static constexpr int64 ReplicationIDBits = 32;
+
+	static void NetSerializeProperties(FNetBitWriter& Writer, const UStruct* Struct, void* Data, UPackageMap* PackageMap,
+		const FNetGUIDCache& GuidCache);
+
+	/** Write a replicated value the way property replication would */
+	static void NetSerializeValue(FNetBitWriter& Writer, const FProperty* Property, void* Value, UPackageMap* PackageMap,
+		const FNetGUIDCache& GuidCache)
+	{
+		if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+		{
+			// Serializing through the package map could export the object and change what the connection actually receives
+			FNetworkGUID NetGUID = GuidCache.GetNetGUID(ObjectProperty->GetObjectPropertyValue(Value));
+			Writer << NetGUID;
+		}
+		else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			FScriptArrayHelper Array(ArrayProperty, Value);
+			uint32 Num = Array.Num();
+			Writer.SerializeIntPacked(Num);
+			for (int32 i = 0; i < Array.Num(); i++)
+			{
+				NetSerializeValue(Writer, ArrayProperty->Inner, Array.GetRawPtr(i), PackageMap, GuidCache);
+			}
+		}
+		else
+		{
+			const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+			if (StructProperty && !(StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative))
+			{
+				NetSerializeProperties(Writer, StructProperty->Struct, Value, PackageMap, GuidCache);
+			}
+			else if (!Property->IsA<FMapProperty>() && !Property->IsA<FSetProperty>())
+			{
+				Property->NetSerializeItem(Writer, PackageMap, Value);
+			}
+		}
+	}
+
+	static void NetSerializeProperties(FNetBitWriter& Writer, const UStruct* Struct, void* Data, UPackageMap* PackageMap,
+		const FNetGUIDCache& GuidCache)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			if (!It->HasAnyPropertyFlags(CPF_RepSkip))
+			{
+				NetSerializeValue(Writer, *It, It->ContainerPtrToValuePtr<void>(Data), PackageMap, GuidCache);
+			}
+		}
+	}
+
+	/**
+	 * @return Bits the spec takes when added to the replicated ActivatableAbilities of an ASC
+	 * Packet and bunch headers are excluded, they are shared with everything else the connection sends that frame
+	 */
+	static int64 GetSpecNetBits(const FGameplayAbilitySpec& Spec, UPackageMap* PackageMap, const FNetGUIDCache& GuidCache)
+	{
+		// Only written from, NetSerializeItem takes mutable data for loading
+		FNetBitWriter Writer(PackageMap, 0);
+		NetSerializeProperties(Writer, FGameplayAbilitySpec::StaticStruct(), const_cast<FGameplayAbilitySpec*>(&Spec), PackageMap, GuidCache);
+		return Writer.GetNumBits() + ReplicationIDBits;
+	}
+
+	/**
+	 * p.Grasp.Bench.Bandwidth in progress
+	 * Walks every remote player's pawn through seeded graspables on the server with the frame time fixed
+	 * Grasp's bytes are measured from the specs it adds to and removes from each player's replicated ActivatableAbilities,
+	 * the connection totals would be swamped by the movement corrections the walked pawns cause
+	 */
+	struct FBandwidthBenchmark
+	{
+		struct FPlayer
+		{
+			FScanBenchmarkPath Path;
+			TWeakObjectPtr<UGraspComponent> GraspComponent;
+			TWeakObjectPtr<UNetConnection> Connection;
+			int32 StartNumGrants = 0;
+
+			/** Specs granted by GraspComponent as of the last sample */
+			TSet<FGameplayAbilitySpecHandle> GraspSpecs;
+		};
+
+		FFixedTimeStep FixedTimeStep;
+		FRecordGrantLatency RecordGrantLatency;
+		TArray<FPlayer> Players;
+		TWeakObjectPtr<UWorld> World;
+		TWeakObjectPtr<AActor> GraspableOwner;
+		FString MapName;
+
+		int32 Frame = 0;
+		int32 NumFrames = 0;
+		bool bComplete = false;
+		double StartWorldTime = 0.0;
+
+		int64 GrantBits = 0;
+		int64 ClearBits = 0;
+		int32 NumSpecsAdded = 0;
+		int32 NumSpecsRemoved = 0;
+
+		FGraspBenchmarkReport Report;
+		FGraspBenchmark::FOnFinished OnFinished;
+
+		/** Add the bits for every Grasp spec that was added to or removed from the player's ASC since the last sample */
+		void SampleGraspSpecs(FPlayer& Player)
+		{
+			UGraspComponent* GC = Player.GraspComponent.Get();
+			UAbilitySystemComponent* ASC = GC ? GC->GetASC() : nullptr;
+			UNetConnection* Connection = Player.Connection.Get();
+			if (!ASC || !Connection || !Connection->Driver || !Connection->Driver->GuidCache.IsValid())
+			{
+				return;
+			}
+
+			TSet<FGameplayAbilitySpecHandle> GraspSpecs;
+			for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+			{
+				if (Spec.SourceObject.Get() != GC)
+				{
+					continue;
+				}
+
+				GraspSpecs.Add(Spec.Handle);
+				if (!Player.GraspSpecs.Contains(Spec.Handle))
+				{
+					GrantBits += GetSpecNetBits(Spec, Connection->PackageMap, *Connection->Driver->GuidCache);
+					NumSpecsAdded++;
+				}
+			}
+
+			for (const FGameplayAbilitySpecHandle& Handle : Player.GraspSpecs)
+			{
+				if (!GraspSpecs.Contains(Handle))
+				{
+					ClearBits += ReplicationIDBits;
+					NumSpecsRemoved++;
+				}
+			}
+
+			Player.GraspSpecs = MoveTemp(GraspSpecs);
+		}
+
+		/** @return False once the benchmark is complete */
+		bool Tick()
+		{
+			for (FPlayer& Player : Players)
+			{
+				if (!Player.GraspComponent.IsValid() || !Player.Connection.IsValid() || !Player.Path.Step())
+				{
+					Report.Failures.Add(TEXT("A player disconnected or lost their pawn"));
+					return false;
+				}
+				SampleGraspSpecs(Player);
+			}
+
+			bComplete = ++Frame >= NumFrames;
+			return !bComplete;
+		}
+
+		void Finish()
+		{
+			const UWorld* WorldPtr = World.Get();
+			if (bComplete && WorldPtr)
+			{
+				int32 NumGrants = 0;
+				for (const FPlayer& Player : Players)
+				{
+					NumGrants += Player.GraspComponent->GetNumGraspAbilitiesGranted() - Player.StartNumGrants;
+				}
+
+				// World time, the same clock the path and the scan timers run on
+				const int32 NumPlayers = FMath::Max(Players.Num(), 1);
+				const double Seconds = FMath::Max(WorldPtr->GetTimeSeconds() - StartWorldTime, UE_KINDA_SMALL_NUMBER);
+				const double GraspBytes = (GrantBits + ClearBits) / 8.0;
+				Report.AddMetric(TEXT("GraspBytesPerSecond"), GraspBytes / Seconds / NumPlayers, TEXT("bytes/s"), EGraspBenchmarkMetricType::Bandwidth);
+				Report.AddMetric(TEXT("GraspBytesPerGrant"), NumSpecsAdded > 0 ? GrantBits / 8.0 / NumSpecsAdded : 0.0, TEXT("bytes"),
+					EGraspBenchmarkMetricType::Bandwidth);
+				Report.AddMetric(TEXT("GraspBytesPerClear"), NumSpecsRemoved > 0 ? ClearBits / 8.0 / NumSpecsRemoved : 0.0, TEXT("bytes"),
+					EGraspBenchmarkMetricType::Bandwidth);
+				Report.AddMetric(TEXT("GrantsPerSecond"), NumGrants / Seconds / NumPlayers, TEXT("grants/s"), EGraspBenchmarkMetricType::Rate);
+				AddGrantLatencyMetrics(Report, MapName, true);
+			}
+
+			for (FPlayer& Player : Players)
+			{
+				Player.Path.Reset();
+			}
+
+			if (AActor* Owner = GraspableOwner.Get())
+			{
+				Owner->Destroy();
+			}
+
+			FGraspBenchmark::Finish(Report, *GLog);
+			if (OnFinished)
+			{
+				OnFinished(Report);
+			}
+		}
+	};
+
+	static TUniquePtr<FScanBenchmark> ActiveScanBenchmark;
+	static TUniquePtr<FBandwidthBenchmark> ActiveBandwidthBenchmark;
+
+	/** Both move pawns, only one may run at a time */
+	static bool IsPathBenchmarkRunning()
+	{
+		return ActiveScanBenchmark.IsValid() || ActiveBandwidthBenchmark.IsValid();
+	}
+
+	template<typename TBenchmark>
+	static bool TickBenchmark(TUniquePtr<TBenchmark>& Benchmark)
+	{
+		if (!Benchmark.IsValid())
+		{
+			return false;
+		}
+
+		if (Benchmark->Tick())
+		{
+			return true;
+		}
+
+		Benchmark->Finish();
+		Benchmark.Reset();
+		return false;
+	}
+
+	static bool TickScanBenchmark(float DeltaTime)
+	{
+		return TickBenchmark(ActiveScanBenchmark);
+	}
+
+	static bool TickBandwidthBenchmark(float DeltaTime)
+	{
+		return TickBenchmark(ActiveBandwidthBenchmark);
+	}
+}
+
+bool FGraspBenchmark::StartScan(UWorld* World, const UGraspData* GraspData, int32 Frames, int32 Seed, int32 NumGraspables, FOutputDevice& Ar,
+	FOnFinished OnFinished)
+{
+	using namespace GraspBenchmark;
+
+	if (IsPathBenchmarkRunning())
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Scan: A benchmark is already running"));
+		return false;
+	}
+
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+	UGraspComponent* GC = PC ? PC->FindComponentByClass<UGraspComponent>() : nullptr;
+	if (!Pawn || !GC || !GraspData)
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Scan: Needs GraspData and a local player with a pawn and a GraspComponent"));
+		return false;
+	}
+
+	AActor* GraspableOwner = SpawnBenchmarkActor(World, TEXT("GraspBenchmarkGraspables"));
+	if (!GraspableOwner)
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Scan: Failed to spawn the graspables"));
+		return false;
+	}
+
+	TUniquePtr<FScanBenchmark> Benchmark = MakeUnique<FScanBenchmark>();
+	Benchmark->GraspComponent = GC;
+	Benchmark->GraspableOwner = GraspableOwner;
+	Benchmark->MapName = FGraspGrantLatency::GetMapName(World);
+	Benchmark->NumFrames = Frames;
+	Benchmark->OnFinished = MoveTemp(OnFinished);
+	Benchmark->Report.Name = TEXT("Scan");
+	Benchmark->Report.Seed = Seed;
+	// Reuse changes the scan cost and memory, so baselines are only compared against runs with the same setting
+	const bool bReuseHandles = FGraspCVars::BenchReuseHandles < 0 ? GC->bReuseTargetingRequestHandles : FGraspCVars::BenchReuseHandles > 0;
+	Benchmark->ReuseTargetingRequestHandles.Enable(GC, bReuseHandles);
+	Benchmark->Report.Config = FString::Printf(TEXT("Frames=%d Graspables=%d GraspData=%s ReuseHandles=%d"), Frames, NumGraspables,
+		*GraspData->GetPathName(), bReuseHandles ? 1 : 0);
+
+	FRandomStream Stream(Seed);
+	Benchmark->Path.Init(Pawn, GraspableOwner, GraspData, NumGraspables, Stream);
+
+	Benchmark->StartScanCost = GC->GetTotalScanDebugCost();
+	Benchmark->StartNumScanCosts = GC->GetNumScanDebugCosts();
+	Benchmark->StartNumGrants = GC->GetNumGraspAbilitiesGranted();
+	Benchmark->StartWorldTime = World->GetTimeSeconds();
+	Benchmark->FixedTimeStep.Enable();
+	Benchmark->RecordGrantLatency.Enable();
+	FGraspGrantLatency::Get().Reset(Benchmark->MapName);
+
+	ActiveScanBenchmark = MoveTemp(Benchmark);
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickScanBenchmark));
+
+	Ar.Logf(TEXT("p.Grasp.Bench.Scan: Running for %d frames with %d graspables"), Frames, NumGraspables);
+	return true;
+}
+
+bool FGraspBenchmark::StartBandwidth(UWorld* World, const UGraspData* GraspData, int32 Frames, int32 Seed, int32 NumGraspables, FOutputDevice& Ar,
+	FOnFinished OnFinished)
+{
+	using namespace GraspBenchmark;
+
+	if (IsPathBenchmarkRunning())
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Bandwidth: A benchmark is already running"));
+		return false;
+	}
+
+	if (!World || !GraspData || World->GetNetMode() == NM_Client || World->GetNetMode() == NM_Standalone)
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Bandwidth: Needs GraspData and must run on a server with clients connected, e.g. PIE as a listen server with 2 or more players"));
+		return false;
+	}
+
+	AActor* GraspableOwner = SpawnBenchmarkActor(World, TEXT("GraspBenchmarkGraspables"));
+	if (!GraspableOwner)
+	{
+		Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Bandwidth: Failed to spawn the graspables"));
+		return false;
+	}
+
+	TUniquePtr<FBandwidthBenchmark> Benchmark = MakeUnique<FBandwidthBenchmark>();
+	Benchmark->World = World;
+	Benchmark->GraspableOwner = GraspableOwner;
+	Benchmark->MapName = FGraspGrantLatency::GetMapName(World);
+	Benchmark->NumFrames = Frames;
+	Benchmark->OnFinished = MoveTemp(OnFinished);
+
+	// Only remote players, the listen server's own player sends nothing over the network
+	FRandomStream Stream(Seed);
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PC = It->Get();
+		UNetConnection* Connection = PC ? PC->GetNetConnection() : nullptr;
+		APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		UGraspComponent* GC = PC ? PC->FindComponentByClass<UGraspComponent>() : nullptr;
+		if (!Connection || !Pawn || !GC || PC->IsLocalController())
+		{
+			continue;
+		}
+
+		FBandwidthBenchmark::FPlayer& Player = Benchmark->Players.AddDefaulted_GetRef();
+		Player.GraspComponent = GC;
+		Player.Connection = Connection;
+		Player.StartNumGrants = GC->GetNumGraspAbilitiesGranted();
+		Player.Path.Init(Pawn, GraspableOwner, GraspData, NumGraspables, Stream);
+
+		// Specs granted before the run are not counted
+		Benchmark->SampleGraspSpecs(Player);
+	}
+
+	if (Benchmark->Players.Num() == 0)
+	{
+		GraspableOwner->Destroy();
+		Ar.Logf(ELogVerbosity::Warning, TEXT("p.Grasp.Bench.Bandwidth: No remote players with a pawn and a GraspComponent"));
+		return false;
+	}
+
+	Benchmark->Report.Name = TEXT("Bandwidth");
+	Benchmark->Report.Seed = Seed;
+	Benchmark->Report.Config = FString::Printf(TEXT("Frames=%d Graspables=%d Players=%d GraspData=%s"), Frames, NumGraspables,
+		Benchmark->Players.Num(), *GraspData->GetPathName());
+
+	Benchmark->GrantBits = 0;
+	Benchmark->ClearBits = 0;
+	Benchmark->NumSpecsAdded = 0;
+	Benchmark->NumSpecsRemoved = 0;
+	Benchmark->StartWorldTime = World->GetTimeSeconds();
+	Benchmark->FixedTimeStep.Enable();
+	Benchmark->RecordGrantLatency.Enable();
+	FGraspGrantLatency::Get().Reset(Benchmark->MapName);
+	const int32 NumPlayers = Benchmark->Players.Num();
+
+	ActiveBandwidthBenchmark = MoveTemp(Benchmark);
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickBandwidthBenchmark));
+
+	Ar.Logf(TEXT("p.Grasp.Bench.Bandwidth: Running for %d frames with %d players"), Frames, NumPlayers);
+	return true;
+}
+
+#endif
@@ -0,0 +1,122 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#if !UE_BUILD_SHIPPING
+
+#include "CoreMinimal.h"
+
+class UWorld;
+class UGraspData;
+
+/** Decides which p.Grasp.Bench.Tolerance applies when comparing against a baseline */
+enum class EGraspBenchmarkMetricType : uint8
+{
+	/** Scan cost and ns/call, regresses when higher */
+	Time,
+	/** Peak bytes held, regresses when higher */
+	Memory,
+	/** Grants per second, regresses when it changes in either direction */
+	Rate,
+	/** Replicated bytes, regresses when higher */
+	Bandwidth,
+};
+
+/** A single measurement taken by a Grasp benchmark */
+struct FGraspBenchmarkMetric
+{
+	FString Name;
+	double Value = 0.0;
+	FString Unit;
+	EGraspBenchmarkMetricType Type = EGraspBenchmarkMetricType::Time;
+};
+
+/**
+ * Results of a Grasp benchmark run
+ * Checksums fold every output of a randomized run, they only match a previous run with the same seed if the results are identical
+ */
+struct FGraspBenchmarkReport
+{
+	/** Bumped whenever the baseline layout or the meaning of a metric changes, baselines from other versions are not compared */
+	static constexpr int32 BaselineVersion = 3;
+
+	FString Name;
+	int32 Seed = 0;
+
+	/** Parameters of the run other than the seed, a baseline is only comparable if these match */
+	FString Config;
+
+	TArray<FGraspBenchmarkMetric> Metrics;
+	TMap<FString, uint32> Checksums;
+
+	/** Golden checks that did not produce their expected output, and regressions against the baseline */
+	TArray<FString> Failures;
+
+	void AddMetric(const FString& MetricName, double Value, const FString& Unit, EGraspBenchmarkMetricType Type)
+	{
+		Metrics.Add({ MetricName, Value, Unit, Type });
+	}
+
+	bool HasPassed() const { return Failures.Num() == 0; }
+
+	void Log(FOutputDevice& Ar) const;
+
+	/** Saved/Grasp/Benchmarks/<Name>.json */
+	FString GetBaselineFilename() const;
+
+	bool WriteBaseline(const FString& Filename) const;
+
+	/**
+	 * Diff against a baseline written by WriteBaseline(), adding a failure for each metric beyond its tolerance and each checksum that differs
+	 * @return False if the baseline could not be read or was recorded with a different version, seed or config
+	 */
+	bool CompareBaseline(const FString& Filename, FOutputDevice& Ar);
+};
+
+/**
+ * Non-shipping benchmarks for the Grasp hot paths, run from the console or the Grasp.Benchmark automation tests
+ * Inputs are generated from a fixed seed so runs are repeatable
+ */
+class FGraspBenchmark
+{
+public:
+	/** Used by the console commands and the automation tests alike, so a baseline written by one can be compared by the other */
+	static constexpr int32 DefaultIterations = 1000000;
+	static constexpr int32 DefaultSeed = 1;
+	static constexpr int32 DefaultFrames = 600;
+	static constexpr int32 DefaultGraspables = 200;
+
+	/** Called with the finished report of a benchmark that runs over several frames */
+	using FOnFinished = TFunction<void(const FGraspBenchmarkReport&)>;
+
+	/**
+	 * Time the UGraspStatics geometry functions over randomized inputs and check them against golden outputs
+	 * Spawns a transient interactor and graspables into the world for the functions that take them
+	 * @param Iterations Number of calls timed for each function
+	 */
+	static FGraspBenchmarkReport RunStatics(UWorld* World, int32 Iterations, int32 Seed);
+
+	/**
+	 * Spawn graspables around the first local player's pawn and walk it along a path for a number of frames
+	 * Reports scan cost, peak memory and grants per second of the player's UGraspComponent
+	 * Placement and path are generated from the seed, the frame time is fixed for the run so the path and scans line up the same every run
+	 * The report is finished on the last frame, then passed to OnFinished
+	 * @return False if the benchmark could not start
+	 */
+	static bool StartScan(UWorld* World, const UGraspData* GraspData, int32 Frames, int32 Seed, int32 NumGraspables, FOutputDevice& Ar,
+		FOnFinished OnFinished = nullptr);
+
+	/**
+	 * Walk every remote player's pawn through seeded graspables on the server, with the frame time fixed as for StartScan()
+	 * Reports the bytes Grasp's grants and clears add to each player's replicated ActivatableAbilities, per second, grant and clear
+	 * The report is finished on the last frame, then passed to OnFinished
+	 * @return False if the benchmark could not start
+	 */
+	static bool StartBandwidth(UWorld* World, const UGraspData* GraspData, int32 Frames, int32 Seed, int32 NumGraspables, FOutputDevice& Ar,
+		FOnFinished OnFinished = nullptr);
+
+	/** Write or compare the baseline as set by p.Grasp.Bench.Baseline, then log the report */
+	static void Finish(FGraspBenchmarkReport& Report, FOutputDevice& Ar);
+};
+
+#endif
@@ -6,6 +6,10 @@
 #include "AbilitySystemComponent.h"
 #include "GraspableComponent.h"
 #include "GraspData.h"
+#include "GraspDataRuntime.h"
+#include "GraspEventLog.h"
+#include "GraspGrantLatency.h"
+#include "GraspStats.h"
 #include "TargetingSystem/TargetingSubsystem.h"
 #include "GameFramework/Controller.h"
 #include "GameFramework/Pawn.h"
@@ -15,6 +19,10 @@
 #include "Components/PrimitiveComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Logging/MessageLog.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "VisualLogger/VisualLogger.h"
+#include "UObject/UObjectIterator.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspComponent)
 
@@ -31,6 +39,70 @@ namespace FGraspCVars
 		TEXT("Enable debug drawing for Grasp ability give and clear."),
 		ECVF_Default);
 #endif
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CMemReport(
+		TEXT("p.Grasp.MemReport"),
+		TEXT("Report the memory allocated by each GraspComponent in the world and by Grasp's global stores, in bytes."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			Ar.Logf(TEXT("%-40s %12s %12s %12s %12s %12s"), TEXT("Owner"), TEXT("AbilityData"), TEXT("ScanResults"),
+				TEXT("Targeting"), TEXT("Other"), TEXT("Total"));
+
+			FGraspMemoryUsage Total;
+			int32 NumComponents = 0;
+			for (TObjectIterator<UGraspComponent> It; It; ++It)
+			{
+				const UGraspComponent* GraspComponent = *It;
+				if (GraspComponent->GetWorld() != World || GraspComponent->IsTemplate())
+				{
+					continue;
+				}
+
+				const FGraspMemoryUsage Usage = GraspComponent->GetGraspMemoryUsage();
+				Ar.Logf(TEXT("%-40s %12llu %12llu %12llu %12llu %12llu"), *GetNameSafe(GraspComponent->GetOwner()),
+					(uint64)Usage.AbilityData, (uint64)Usage.ScanResults, (uint64)Usage.Targeting, (uint64)Usage.Other, (uint64)Usage.GetTotal());
+
+				Total.AbilityData += Usage.AbilityData;
+				Total.ScanResults += Usage.ScanResults;
+				Total.Targeting += Usage.Targeting;
+				Total.Other += Usage.Other;
+				NumComponents++;
+			}
+
+			Ar.Logf(TEXT("%-40s %12llu %12llu %12llu %12llu %12llu"), *FString::Printf(TEXT("Total (%d components)"), NumComponents),
+				(uint64)Total.AbilityData, (uint64)Total.ScanResults, (uint64)Total.Targeting, (uint64)Total.Other, (uint64)Total.GetTotal());
+
+			// Shared by every GraspComponent, not included in the totals above
+			const UGraspEventLog* EventLog = World ? World->GetSubsystem<UGraspEventLog>() : nullptr;
+			Ar.Logf(TEXT("Runtime table: %llu bytes (%d entries)"), (uint64)FGraspDataRuntimeTable::Get().GetAllocatedSize(), FGraspDataRuntimeTable::Get().Num());
+			Ar.Logf(TEXT("Targeting request data: %llu bytes"), (uint64)FGraspTargetingRequestData::GetStoreAllocatedSize());
+			Ar.Logf(TEXT("Selection contexts: %llu bytes"), (uint64)FGraspSelectionContext::GetStoreAllocatedSize());
+			Ar.Logf(TEXT("Event log: %llu bytes"), (uint64)(EventLog ? EventLog->GetAllocatedSize() : 0));
+
+			// Compare against the same level with hard GraspAbility references to measure what soft references save
+			TSet<FSoftObjectPath> SoftAbilities;
+			TSet<const UClass*> LoadedSoftAbilities;
+			SIZE_T LoadedSoftAbilityBytes = 0;
+			for (TObjectIterator<UGraspData> It; It; ++It)
+			{
+				const TSoftClassPtr<UGameplayAbility>& SoftAbility = It->GetSoftGraspAbility();
+				if (It->IsTemplate() || SoftAbility.IsNull())
+				{
+					continue;
+				}
+
+				SoftAbilities.Add(SoftAbility.ToSoftObjectPath());
+				UClass* AbilityClass = SoftAbility.Get();
+				if (AbilityClass && !LoadedSoftAbilities.Contains(AbilityClass))
+				{
+					LoadedSoftAbilities.Add(AbilityClass);
+					LoadedSoftAbilityBytes += AbilityClass->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal) +
+						AbilityClass->GetDefaultObject()->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+				}
+			}
+			Ar.Logf(TEXT("Soft grasp abilities: %d of %d loaded, %llu bytes resident"), LoadedSoftAbilities.Num(),
+				SoftAbilities.Num(), (uint64)LoadedSoftAbilityBytes);
+		}));
 }
 
 UGraspComponent::UGraspComponent(const FObjectInitializer& ObjectInitializer)
@@ -44,12 +116,69 @@ UGraspComponent::UGraspComponent(const FObjectInitializer& ObjectInitializer)
 	SetIsReplicatedByDefault(false);
 }
 
+void UGraspComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	EndAllTargetingRequests(false);
+	ReleasePersistentTargetingRequests();
+	UnbindCanActivateMemo();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGraspComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(GetGraspMemoryUsage().GetTotal());
+}
+
+FGraspMemoryUsage UGraspComponent::GetGraspMemoryUsage() const
+{
+	FGraspMemoryUsage Usage;
+
+	// FGameplayAbilitySpec and the other inline members are counted by the map's own allocation
+	Usage.AbilityData = AbilityData.GetAllocatedSize();
+	for (const TPair<TSubclassOf<UGameplayAbility>, FGraspAbilityData>& Entry : AbilityData)
+	{
+		Usage.AbilityData += Entry.Value.Graspables.GetAllocatedSize() + Entry.Value.LockedGraspables.GetAllocatedSize();
+	}
+
+	Usage.ScanResults = CurrentScanResults.GetAllocatedSize();
+
+	Usage.Targeting = TargetingRequests.GetAllocatedSize() + PersistentTargetingRequests.GetAllocatedSize()
+		+ CurrentTargetingPresets.GetAllocatedSize() + ScanLODStates.GetAllocatedSize();
+	for (const TPair<FGameplayTag, FGraspScanLODState>& Entry : ScanLODStates)
+	{
+		Usage.Targeting += Entry.Value.Candidates.IsValid() ? Entry.Value.Candidates->GetAllocatedSize() : 0;
+	}
+
+	Usage.Other = CanActivateMemo.GetAllocatedSize() + ScanDebugInfo.GetAllocatedSize() + ScanCostHistory.GetAllocatedSize();
+	for (const TPair<FGameplayTag, FGraspScanDebugInfo>& Entry : ScanDebugInfo)
+	{
+		Usage.Other += Entry.Value.FilterCounts.GetAllocatedSize();
+	}
+
+#if !UE_BUILD_SHIPPING
+	Usage.Other += GrantLatencyScans.GetAllocatedSize();
+	for (const TPair<FGameplayTag, FGraspGrantLatencyScan>& Entry : GrantLatencyScans)
+	{
+		Usage.Other += Entry.Value.Results.GetAllocatedSize();
+	}
+#endif
+
+	return Usage;
+}
+
 void UGraspComponent::InitializeGrasp(UAbilitySystemComponent* InAbilitySystemComponent, TSubclassOf<UGameplayAbility> ScanAbility)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::InitializeGrasp);
+	LLM_SCOPE_BYTAG(Grasp);
 	
 	if (IsValid(GetOwner()))
 	{
+		// Unbind from the previous ability system component
+		UnbindCanActivateMemo();
+
 		// Cache the ability system component
 		ASC = InAbilitySystemComponent;
 
@@ -69,6 +198,29 @@ void UGraspComponent::InitializeGrasp(UAbilitySystemComponent* InAbilitySystemCo
 		// Cache the owning controller
 		Controller = Cast<AController>(GetOwner());
 
+		if (bMemoizeCanActivateAbility)
+		{
+			BindCanActivateMemo();
+		}
+
+		// Load any soft referenced abilities that must be resident
+		if (PreloadGraspAbilities.Num() > 0 && !PreloadGraspAbilitiesHandle.IsValid())
+		{
+			TArray<FSoftObjectPath> PreloadPaths;
+			PreloadPaths.Reserve(PreloadGraspAbilities.Num());
+			for (const TSoftClassPtr<UGameplayAbility>& Ability : PreloadGraspAbilities)
+			{
+				if (!Ability.IsNull())
+				{
+					PreloadPaths.Add(Ability.ToSoftObjectPath());
+				}
+			}
+			if (PreloadPaths.Num() > 0)
+			{
+				PreloadGraspAbilitiesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(PreloadPaths);
+			}
+		}
+
 		if (GetOwner()->HasAuthority())
 		{
 			// Pre-grant common grasp abilities
@@ -106,10 +258,15 @@ void UGraspComponent::InitializeGrasp(UAbilitySystemComponent* InAbilitySystemCo
 			// Cache the preset update mode to detect changed
 			bLastUpdateTargetingPresetsOnPawnChange = bUpdateTargetingPresetsOnPawnChange;
 
+			// Discard anything cached from a previous initialization
+			InvalidateMaxGraspScanRate();
+			InvalidateTargetingSource();
+
 			// Get the targeting presets
 			if (ScanAbilityHandle.IsValid())
 			{
 				CurrentTargetingPresets = ObjectPtrWrap(GetTargetingPresets());
+				CurrentTargetingPresetsVersion = TargetingPresetsVersion;
 			}
 
 			// Bind the pawn changed event if required
@@ -138,6 +295,286 @@ AActor* UGraspComponent::GetTargetingSource_Implementation() const
 	return nullptr;
 }
 
+float UGraspComponent::GetCachedMaxGraspScanRate() const
+{
+	if (!bCacheGraspScanParameters)
+	{
+		return GetMaxGraspScanRate();
+	}
+
+	if (!CachedMaxGraspScanRate.IsSet())
+	{
+		CachedMaxGraspScanRate = GetMaxGraspScanRate();
+	}
+	return CachedMaxGraspScanRate.GetValue();
+}
+
+AActor* UGraspComponent::GetCachedTargetingSource() const
+{
+	if (!bCacheGraspScanParameters)
+	{
+		return GetTargetingSource();
+	}
+
+	// Re-evaluated if it was invalidated or destroyed, or the possessed pawn changed without notifying us (e.g. on clients)
+	const APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+	if (!CachedTargetingSource.IsValid() || CachedTargetingSourcePawn.Get() != Pawn)
+	{
+		CachedTargetingSource = GetTargetingSource();
+		CachedTargetingSourcePawn = Pawn;
+	}
+	return CachedTargetingSource.Get();
+}
+
+void UGraspComponent::PrepareScanLODRequest(const FGameplayTag& ScanTag, const FTargetingRequestHandle& TargetingHandle)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::PrepareScanLODRequest);
+
+	// Every request has data, so the selection can record that it sorted the results for the range filters
+	FGraspTargetingRequestData& RequestData = FGraspTargetingRequestData::FindOrAdd(TargetingHandle);
+	RequestData.bSortedByDistance = false;
+
+	// The Gameplay Debugger wants to know how this request went
+	if (IsCollectingScanDebugInfo())
+	{
+		RequestData.bCollectDebug = true;
+		RequestData.DebugStartTime = FPlatformTime::Seconds();
+		RequestData.FilterCounts.Reset();
+	}
+
+	if (!bEnableScanLOD || !IsValid(GetWorld()))
+	{
+		return;
+	}
+
+	const FGraspScanLODState& State = ScanLODStates.FindOrAdd(ScanTag);
+
+	// Coarse until one has completed, then again every CoarseScanInterval
+	if (State.LastCoarseScanTime < 0.f || GetWorld()->TimeSince(State.LastCoarseScanTime) >= CoarseScanInterval)
+	{
+		RequestData.Tier = EGraspScanTier::Coarse;
+	}
+	else
+	{
+		RequestData.Tier = EGraspScanTier::Fine;
+		RequestData.FineCandidates = State.Candidates;
+	}
+}
+
+void UGraspComponent::CompleteScanLODRequest(const FGameplayTag& ScanTag, const FTargetingRequestHandle& TargetingHandle)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::CompleteScanLODRequest);
+
+	FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle);
+	if (!RequestData)
+	{
+		return;
+	}
+
+	if (RequestData->Tier == EGraspScanTier::Coarse && IsValid(GetWorld()))
+	{
+		FGraspScanLODState& State = ScanLODStates.FindOrAdd(ScanTag);
+		State.Candidates = MakeShared<TArray<TWeakObjectPtr<UPrimitiveComponent>>>(MoveTemp(RequestData->Candidates));
+		State.LastCoarseScanTime = GetWorld()->GetTimeSeconds();
+	}
+
+	if (RequestData->bCollectDebug)
+	{
+		FGraspScanDebugInfo& DebugInfo = ScanDebugInfo.FindOrAdd(ScanTag);
+		DebugInfo.LastLatencyMs = (FPlatformTime::Seconds() - RequestData->DebugStartTime) * 1000.0;
+		DebugInfo.LastTier = RequestData->Tier;
+		DebugInfo.FilterCounts = MoveTemp(RequestData->FilterCounts);
+	}
+
+	FGraspTargetingRequestData::Remove(TargetingHandle);
+}
+
+void UGraspComponent::AddScanDebugCost(float Milliseconds)
+{
+	// Enough for the Gameplay Debugger graph, removing from the front of something this small is cheap
+	static constexpr int32 MaxScanCostHistory = 64;
+	if (ScanCostHistory.Num() >= MaxScanCostHistory)
+	{
+		ScanCostHistory.RemoveAt(0, ScanCostHistory.Num() - MaxScanCostHistory + 1);
+	}
+	ScanCostHistory.Add(Milliseconds);
+
+	TotalScanDebugCost += Milliseconds;
+	NumScanDebugCosts++;
+}
+
+bool UGraspComponent::FindCanActivateMemo(const FGraspCanActivateMemoKey& Key, bool& bOutCanActivate) const
+{
+	if (!bMemoizeCanActivateAbility || !IsValid(GetWorld()))
+	{
+		return false;
+	}
+
+	const FGraspCanActivateMemoEntry* Entry = CanActivateMemo.Find(Key);
+	if (!Entry || GetWorld()->TimeSince(Entry->Time) > CanActivateMemoDuration)
+	{
+		INC_DWORD_STAT(STAT_GraspCanActivateMemoMisses);
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_GraspCanActivateMemoHits);
+	bOutCanActivate = Entry->bCanActivate;
+	return true;
+}
+
+void UGraspComponent::AddCanActivateMemo(const FGraspCanActivateMemoKey& Key, bool bCanActivate)
+{
+	if (!bMemoizeCanActivateAbility || !IsValid(GetWorld()))
+	{
+		return;
+	}
+
+	LLM_SCOPE_BYTAG(Grasp);
+
+	// Entries for cleared specs and graspables that left range are never found again, drop them once expired
+	const float Now = GetWorld()->GetTimeSeconds();
+	if (CanActivateMemo.Num() >= 64)
+	{
+		for (auto It = CanActivateMemo.CreateIterator(); It; ++It)
+		{
+			if (Now - It.Value().Time > CanActivateMemoDuration)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	FGraspCanActivateMemoEntry& Entry = CanActivateMemo.FindOrAdd(Key);
+	Entry.Time = Now;
+	Entry.bCanActivate = bCanActivate;
+}
+
+void UGraspComponent::BindCanActivateMemo()
+{
+	UAbilitySystemComponent* AbilitySystem = GetASC();
+	if (bCanActivateMemoBound || !AbilitySystem)
+	{
+		return;
+	}
+
+	// Cooldowns and blocking tags are applied as owned tags, costs and cooldowns by gameplay effects
+	OwnedTagsChangedHandle = AbilitySystem->RegisterGenericGameplayTagEvent().AddUObject(this, &ThisClass::OnOwnedTagsChanged);
+	EffectAppliedHandle = AbilitySystem->OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &ThisClass::OnEffectApplied);
+	EffectRemovedHandle = AbilitySystem->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &ThisClass::OnEffectRemoved);
+	AbilityActivatedHandle = AbilitySystem->AbilityActivatedCallbacks.AddUObject(this, &ThisClass::OnAbilityActivated);
+	AbilityEndedHandle = AbilitySystem->OnAbilityEnded.AddUObject(this, &ThisClass::OnAbilityEnded);
+	bCanActivateMemoBound = true;
+
+	InvalidateCanActivateMemo();
+}
+
+void UGraspComponent::UnbindCanActivateMemo()
+{
+	if (!bCanActivateMemoBound)
+	{
+		return;
+	}
+
+	if (UAbilitySystemComponent* AbilitySystem = GetASC())
+	{
+		AbilitySystem->RegisterGenericGameplayTagEvent().Remove(OwnedTagsChangedHandle);
+		AbilitySystem->OnGameplayEffectAppliedDelegateToSelf.Remove(EffectAppliedHandle);
+		AbilitySystem->OnAnyGameplayEffectRemovedDelegate().Remove(EffectRemovedHandle);
+		AbilitySystem->AbilityActivatedCallbacks.Remove(AbilityActivatedHandle);
+		AbilitySystem->OnAbilityEnded.Remove(AbilityEndedHandle);
+	}
+
+	bCanActivateMemoBound = false;
+	InvalidateCanActivateMemo();
+}
+
+FTargetingRequestHandle UGraspComponent::AcquireTargetingRequestHandle(UTargetingSubsystem* TargetSubsystem,
+	const FGameplayTag& ScanTag, const UTargetingPreset* Preset, AActor* TargetingSource)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::AcquireTargetingRequestHandle);
+
+	if (!bReuseTargetingRequestHandles)
+	{
+		// Discard anything kept from before reuse was disabled
+		if (PersistentTargetingRequests.Num() > 0)
+		{
+			ReleasePersistentTargetingRequests();
+		}
+
+		const FTargetingRequestHandle Handle = TargetSubsystem->MakeTargetRequestHandle(Preset, FTargetingSourceContext{TargetingSource});
+		FTargetingAsyncTaskData::FindOrAdd(Handle).bReleaseOnCompletion = true;
+		INC_DWORD_STAT(STAT_GraspTargetingHandlesCreated);
+		return Handle;
+	}
+
+	FGraspPersistentTargetingRequest& Request = PersistentTargetingRequests.FindOrAdd(ScanTag);
+	if (Request.Handle.IsValid() && Request.Preset.Get() == Preset)
+	{
+		// Reset the data stores in place, keeping their allocations
+		if (FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(Request.Handle))
+		{
+			SourceContext->SourceActor = TargetingSource;
+		}
+		if (FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(Request.Handle))
+		{
+			Results->TargetResults.Reset();
+		}
+
+		// Clear the task state from the last scan so the task set runs again
+		FTargetingAsyncTaskData& AsyncTaskData = FTargetingAsyncTaskData::FindOrAdd(Request.Handle);
+		AsyncTaskData = FTargetingAsyncTaskData();
+		AsyncTaskData.bReleaseOnCompletion = false;
+
+		INC_DWORD_STAT(STAT_GraspTargetingHandlesReused);
+		return Request.Handle;
+	}
+
+	// First scan for this preset, or the preset was replaced
+	if (Request.Handle.IsValid())
+	{
+		UTargetingSubsystem::ReleaseTargetRequestHandle(Request.Handle);
+		DEC_DWORD_STAT(STAT_GraspPersistentTargetingHandles);
+	}
+
+	Request.Handle = TargetSubsystem->MakeTargetRequestHandle(Preset, FTargetingSourceContext{TargetingSource});
+	Request.Preset = Preset;
+	FTargetingAsyncTaskData::FindOrAdd(Request.Handle).bReleaseOnCompletion = false;
+
+	INC_DWORD_STAT(STAT_GraspTargetingHandlesCreated);
+	INC_DWORD_STAT(STAT_GraspPersistentTargetingHandles);
+	return Request.Handle;
+}
+
+void UGraspComponent::ReleasePersistentTargetingRequests(const FGameplayTag& ScanTag)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::ReleasePersistentTargetingRequests);
+
+	for (auto It = PersistentTargetingRequests.CreateIterator(); It; ++It)
+	{
+		if (ScanTag.IsValid() && It.Key() != ScanTag)
+		{
+			continue;
+		}
+
+		FTargetingRequestHandle& Handle = It.Value().Handle;
+		if (Handle.IsValid())
+		{
+			// Still in-flight, let the subsystem release it once it completes
+			const FTargetingRequestHandle* InFlight = TargetingRequests.Find(It.Key());
+			if (InFlight && *InFlight == Handle)
+			{
+				FTargetingAsyncTaskData::FindOrAdd(Handle).bReleaseOnCompletion = true;
+			}
+			else
+			{
+				UTargetingSubsystem::ReleaseTargetRequestHandle(Handle);
+			}
+			DEC_DWORD_STAT(STAT_GraspPersistentTargetingHandles);
+		}
+		It.RemoveCurrent();
+	}
+}
+
 TMap<FGameplayTag, UTargetingPreset*> UGraspComponent::GetTargetingPresets_Implementation() const
 {
 	return ObjectPtrDecay(DefaultTargetingPresets);
@@ -176,6 +613,10 @@ void UGraspComponent::OnPawnChanged(APawn* OldPawn, APawn* NewPawn)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::OnPawnChanged);
 
+	// The targeting source is typically the pawn, and the candidates were found around it
+	InvalidateTargetingSource();
+	InvalidateScanLOD();
+
 	// Optionally end targeting requests
 	if (bEndTargetingRequestsOnPawnChange)
 	{
@@ -193,16 +634,46 @@ void UGraspComponent::UpdateTargetingPresets()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::UpdateTargetingPresets);
 	
-	const TMap<FGameplayTag, UTargetingPreset*> LastTargetingPresets = ObjectPtrDecay(CurrentTargetingPresets);
-	CurrentTargetingPresets = ObjectPtrWrap(GetTargetingPresets());
+	const TMap<FGameplayTag, UTargetingPreset*> NewTargetingPresets = GetTargetingPresets();
+	CurrentTargetingPresetsVersion = TargetingPresetsVersion;
+
+	// Update in place, tracking presets that were removed or replaced
+	TArray<FGameplayTag, TInlineAllocator<4>> ChangedPresets;
+	for (auto It = CurrentTargetingPresets.CreateIterator(); It; ++It)
+	{
+		UTargetingPreset* const* NewPreset = NewTargetingPresets.Find(It.Key());
+		if (!NewPreset || *NewPreset != It.Value())
+		{
+			ChangedPresets.Add(It.Key());
+			if (NewPreset)
+			{
+				It.Value() = *NewPreset;
+			}
+			else
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
 
-	// Clear out any tags that are no longer valid
-	for (const auto& Preset : LastTargetingPresets)
+	// Add any new presets
+	for (const auto& Preset : NewTargetingPresets)
 	{
 		if (!CurrentTargetingPresets.Contains(Preset.Key))
 		{
-			EndTargetingRequests(Preset.Key);
+			CurrentTargetingPresets.Add(Preset.Key, Preset.Value);
+		}
+	}
+
+	// End in-progress requests for changed presets only, once CurrentTargetingPresets is consistent
+	for (const FGameplayTag& PresetTag : ChangedPresets)
+	{
+		ScanLODStates.Remove(PresetTag);
+		if (TargetingRequests.Contains(PresetTag))
+		{
+			EndTargetingRequests(PresetTag);
 		}
+		ReleasePersistentTargetingRequests(PresetTag);
 	}
 }
 
@@ -219,6 +690,15 @@ void UGraspComponent::DrawDebugGrantAbilityBox(const UPrimitiveComponent* Compon
 			FString::Printf(TEXT("%s: %s"), *Info, *Ability), nullptr, Color, 1.4f, true);
 	}
 #endif
+
+#if ENABLE_VISUAL_LOG
+	// Logged to the targeting source alongside its scans
+	if (const AActor* LogOwner = GetCachedTargetingSource())
+	{
+		UE_VLOG_BOX(LogOwner, LogGraspScan, Log, Component->Bounds.GetBox(), Color,
+			TEXT("%s: %s (%s)"), *Info, *Ability, *Component->GetName());
+	}
+#endif
 }
 
 void UGraspComponent::DrawDebugGrantAbilityLine(const UPrimitiveComponent* Component, const FColor& Color) const
@@ -235,11 +715,21 @@ void UGraspComponent::DrawDebugGrantAbilityLine(const UPrimitiveComponent* Compo
 		}
 	}
 #endif
+
+#if ENABLE_VISUAL_LOG
+	if (const AActor* LogOwner = GetCachedTargetingSource())
+	{
+		UE_VLOG_SEGMENT(LogOwner, LogGraspScan, Verbose, LogOwner->GetActorLocation(), Component->GetComponentLocation(), Color,
+			TEXT("%s"), *Component->GetName());
+	}
+#endif
 }
 
-void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
+void UGraspComponent::GraspTargetsReady(const FGameplayTag& ScanTag, const TArray<FGraspScanResult>& Results)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspComponent::GraspTargetsReady);
+	CSV_SCOPED_TIMING_STAT(Grasp, GraspTargetsReady);
+	LLM_SCOPE_BYTAG(Grasp);
 
 	if (!HasValidData())
 	{
@@ -249,6 +739,25 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 	// Update our current focus results
 	TArray<FGraspScanResult> LastScanResults = CurrentScanResults;
 	CurrentScanResults = Results;
+
+#if !UE_BUILD_SHIPPING
+	// Compare against this preset's previous results, the other presets scan on their own
+	double SinceLastResults = 0.0;
+	TArray<FGraspScanResult> LastPresetResults;
+	if (FGraspGrantLatency::IsEnabled())
+	{
+		const double Now = GetWorld()->GetTimeSeconds();
+		FGraspGrantLatencyScan& LastScan = GrantLatencyScans.FindOrAdd(ScanTag);
+		SinceLastResults = LastScan.Time >= 0.0 ? Now - LastScan.Time : 0.0;
+		LastPresetResults = MoveTemp(LastScan.Results);
+		LastScan.Time = Now;
+		LastScan.Results = Results;
+	}
+	else
+	{
+		GrantLatencyScans.Reset();
+	}
+#endif
 	
 	// Grant any new abilities that aren't pre-granted
 	for (const FGraspScanResult& Result : Results)
@@ -258,9 +767,49 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 		// We have already filtered for these
 		const UPrimitiveComponent* Component = Result.Graspable.IsValid() ? Result.Graspable.Get() : nullptr;
 		const IGraspableComponent* Graspable = CastChecked<IGraspableComponent>(Component);
+		const FGraspDataRuntime* Runtime = Graspable->GetGraspDataRuntime();
+		if (!Runtime)
+		{
+			continue;
+		}
 
 		// Ability to grant
-		const TSubclassOf<UGameplayAbility>& Ability = Graspable->GetGraspData()->GetGraspAbility();
+		const TSubclassOf<UGameplayAbility> Ability = Runtime->GetGraspAbility();
+
+		// Soft referenced ability is not loaded yet, the grant is deferred until a scan after it has loaded
+		if (!Ability)
+		{
+			if (Runtime->bAbilityLoadPending)
+			{
+				UE_LOG(LogGrasp, VeryVerbose,
+					TEXT("%s GraspComponent::GraspTargetsReady: Deferring grant for %s, ability is loading"),
+					*GetRoleString(), *Component->GetName());
+				UE_VLOG(GetCachedTargetingSource(), LogGraspScan, Log, TEXT("Deferring grant for %s, ability is loading"), *Component->GetName());
+				Runtime->Source->RequestAsyncLoadGraspAbility();
+			}
+			continue;
+		}
+
+		// Persistent abilities are pre-granted via CommonGraspAbilities, scanning never grants them
+		if (Runtime->bPersistentAbility)
+		{
+			const FGraspAbilityData* PersistentData = AbilityData.Find(Ability);
+			if (!PersistentData || !PersistentData->bPersistent)
+			{
+				UE_LOG(LogGrasp, Verbose,
+					TEXT("%s GraspComponent::GraspTargetsReady: Persistent ability %s for %s is not pre-granted, add it to CommonGraspAbilities"),
+					*GetRoleString(), *Ability->GetName(), *Component->GetName());
+				UE_VLOG(GetCachedTargetingSource(), LogGraspScan, Warning, TEXT("Persistent ability %s for %s is not pre-granted"),
+					*Ability->GetName(), *Component->GetName());
+			}
+#if UE_ENABLE_DEBUG_DRAWING || ENABLE_VISUAL_LOG
+			else
+			{
+				DrawDebugGrantAbilityLine(Component, FColor::Purple);
+			}
+#endif
+			continue;
+		}
 
 		// Add ability data
 		FGraspAbilityData& Data = AbilityData.FindOrAdd(Ability);
@@ -291,7 +840,7 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 		}
 
 		// Too far away to grant the ability
-		const float RequiredDistance = Graspable->GetGraspData()->NormalizedGrantAbilityDistance;
+		const float RequiredDistance = Runtime->NormalizedGrantAbilityDistance;
 		if (Result.NormalizedScanDistance > RequiredDistance)
 		{
 #if UE_ENABLE_DEBUG_DRAWING || ENABLE_VISUAL_LOG
@@ -302,8 +851,9 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 			{
 				const float GrantAbilityPct = 100.f * FMath::Clamp<float>(UKismetMathLibrary::NormalizeToRange(Result.NormalizedScanDistance, RequiredDistance, 1.f), 0.f, 1.f);
 
-				const FVector TextLocation = GetTargetingSource() ? FMath::Lerp<FVector>(Component->GetComponentLocation(),
-					GetTargetingSource()->GetActorLocation(), RequiredDistance) : Component->GetComponentLocation();
+				const AActor* TargetingSource = GetCachedTargetingSource();
+				const FVector TextLocation = TargetingSource ? FMath::Lerp<FVector>(Component->GetComponentLocation(),
+					TargetingSource->GetActorLocation(), RequiredDistance) : Component->GetComponentLocation();
 
 				DrawDebugString(GetWorld(), TextLocation + FVector(0.f, 0.f, 10.f),
 					FString::Printf(TEXT("%.2f%%"), GrantAbilityPct),
@@ -314,6 +864,8 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 			UE_LOG(LogGrasp, VeryVerbose,
 				TEXT("%s GraspComponent::GraspTargetsReady: Not granting ability %s to %s, too far away. NormalizedDistance: %.1f"),
 				*GetRoleString(), *Ability->GetName(), *Result.Graspable->GetName(), Result.NormalizedScanDistance);
+			UE_VLOG(GetCachedTargetingSource(), LogGraspScan, Verbose, TEXT("Not granting %s to %s, NormalizedDistance %.2f > %.2f"),
+				*Ability->GetName(), *Component->GetName(), Result.NormalizedScanDistance, RequiredDistance);
 			continue;
 		}
 
@@ -336,9 +888,24 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 			Data.Spec = Spec;
 			Data.Ability = Ability;
 			Data.Graspables.Add(Result.Graspable.Get());
+			UGraspEventLog::Record(this, EGraspEventType::Grant, this, Component, Ability->GetFName());
+			CSV_CUSTOM_STAT(Grasp, Grants, 1, ECsvCustomStatOp::Accumulate);
+			NumGraspAbilitiesGranted++;
+
+#if !UE_BUILD_SHIPPING
+			// Estimate when we entered grant range by interpolating from the previous result, or the edge of scan range if there was none
+			if (FGraspGrantLatency::IsEnabled())
+			{
+				const FGraspScanResult* LastResult = LastPresetResults.FindByKey(Result);
+				const float LastDistance = LastResult ? LastResult->NormalizedScanDistance : 1.f;
+				const float EnterAlpha = LastDistance > Result.NormalizedScanDistance ?
+					FMath::Clamp((RequiredDistance - Result.NormalizedScanDistance) / (LastDistance - Result.NormalizedScanDistance), 0.f, 1.f) : 1.f;
+				FGraspGrantLatency::Get().OnGiveAbility(this, Handle, SinceLastResults * EnterAlpha);
+			}
+#endif
 
 			// Extension point
-			PostGiveGraspAbility(Ability, Component, Graspable->GetGraspData(), Data);
+			PostGiveGraspAbility(Ability, Component, Runtime->Source, Data);
 		}
 	}
 	
@@ -362,20 +929,20 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 		const IGraspableComponent* Graspable = CastChecked<IGraspableComponent>(Component);
 
 		// No data to retrieve ability from
-		const UGraspData* GraspData = Graspable->GetGraspData();
-		if (!GraspData)
+		const FGraspDataRuntime* Runtime = Graspable->GetGraspDataRuntime();
+		if (!Runtime)
 		{
 			continue;
 		}
 		
-		// If this ability is marked for manual clearing, skip it
-		if (GraspData->bManualClearAbility)
+		// If this ability is marked for manual clearing or is persistent, skip it
+		if (Runtime->bManualClearAbility || Runtime->bPersistentAbility)
 		{
 			continue;
 		}
 
 		// Get the ability to remove
-		const TSubclassOf<UGameplayAbility>& Ability = Graspable->GetGraspData()->GetGraspAbility();
+		const TSubclassOf<UGameplayAbility> Ability = Runtime->GetGraspAbility();
 
 		// No ability to remove
 		if (!Ability)
@@ -446,7 +1013,9 @@ void UGraspComponent::GraspTargetsReady(const TArray<FGraspScanResult>& Results)
 				// But what if something with the same ability exists in the current results?
 				// Cache the result and do it later, but only if still required
 				
-				PreClearGraspAbility(Ability, Graspable->GetGraspData(), *Data);
+				PreClearGraspAbility(Ability, Runtime->Source, *Data);
+				UGraspEventLog::Record(this, EGraspEventType::Clear, this, Component, Ability->GetFName());
+				CSV_CUSTOM_STAT(Grasp, Clears, 1, ECsvCustomStatOp::Accumulate);
 				ASC->ClearAbility(Data->Handle);
 				AbilityData.Remove(Ability);
 			}
@@ -544,7 +1113,16 @@ void UGraspComponent::EndTargetingRequests(const FGameplayTag& PresetTag, bool b
 			if (!PresetTag.IsValid() || Request.Key == PresetTag)
 			{
 				RemovedRequests.Add(Request.Key);
+
+				// A removed request may be left mid-way through its task set, don't reuse it
+				if (PersistentTargetingRequests.Remove(Request.Key) > 0)
+				{
+					FTargetingAsyncTaskData::FindOrAdd(Request.Value).bReleaseOnCompletion = true;
+					DEC_DWORD_STAT(STAT_GraspPersistentTargetingHandles);
+				}
+
 				TargetSubsystem->RemoveAsyncTargetingRequestWithHandle(Request.Value);
+				FGraspTargetingRequestData::Remove(Request.Value);
 			}
 		}
 
@@ -580,8 +1158,8 @@ bool UGraspComponent::IsGrantedGameplayAbilityInRange(TSubclassOf<UGameplayAbili
 		const IGraspableComponent* Graspable = CastChecked<IGraspableComponent>(Component);
 
 		// Ability to grant via data
-		const TSubclassOf<UGameplayAbility>& Ability = Graspable->GetGraspData()->GetGraspAbility();
-		if (Ability == InAbility)
+		const FGraspDataRuntime* Runtime = Graspable->GetGraspDataRuntime();
+		if (Runtime && Runtime->GetGraspAbility() == InAbility)
 		{
 			return true;
 		}
@@ -634,6 +1212,8 @@ bool UGraspComponent::ClearGrantedGameplayAbility(TSubclassOf<UGameplayAbility>
 	}
 
 	PreClearGraspAbility(InAbility, nullptr, *Data);
+	UGraspEventLog::Record(this, EGraspEventType::Clear, this, nullptr, InAbility->GetFName());
+	CSV_CUSTOM_STAT(Grasp, Clears, 1, ECsvCustomStatOp::Accumulate);
 	
 	ASC->ClearAbility(Data->Handle);
 	AbilityData.Remove(InAbility);
@@ -704,6 +1284,8 @@ void UGraspComponent::ClearAllGrantedGameplayAbilities(bool bClearCommonAbilitie
 		
 		const UGraspData* GraspData = ValidComponent ? CastChecked<IGraspableComponent>(ValidComponent->Get())->GetGraspData() : nullptr;
 		PreClearGraspAbility(Data.Ability, GraspData, Data);
+		UGraspEventLog::Record(this, EGraspEventType::Clear, this, ValidComponent ? ValidComponent->Get() : nullptr, GetFNameSafe(Data.Ability));
+		CSV_CUSTOM_STAT(Grasp, Clears, 1, ECsvCustomStatOp::Accumulate);
 		ASC->ClearAbility(Data.Handle);
 		Data.Handle = FGameplayAbilitySpecHandle();
 		Data.Spec = FGameplayAbilitySpec();
@@ -793,6 +1375,8 @@ bool UGraspComponent::RemoveAbilityLock(const UPrimitiveComponent* GraspableComp
 					// Clear the ability
 					const UGraspData* GraspData = Graspable->GetGraspData();
 					PreClearGraspAbility(Data->Ability, GraspData, *Data);
+					UGraspEventLog::Record(this, EGraspEventType::Clear, this, GraspableComponent, GetFNameSafe(Data->Ability));
+					CSV_CUSTOM_STAT(Grasp, Clears, 1, ECsvCustomStatOp::Accumulate);
 					ASC->ClearAbility(Data->Handle);
 					Data->Handle = FGameplayAbilitySpecHandle();
 					Data->Spec = FGameplayAbilitySpec();
@@ -2,7 +2,10 @@
 
 
 #include "GraspData.h"
+#include "GraspDataRuntime.h"
 #include "Abilities/GameplayAbility.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 #if WITH_EDITOR
 #include "Misc/DataValidation.h"
@@ -13,7 +16,76 @@
 
 TSubclassOf<UGameplayAbility> UGraspData::GetGraspAbility_Implementation() const
 {
-	return GraspAbility;
+	if (GraspAbility)
+	{
+		return GraspAbility;
+	}
+	return SoftGraspAbility.Get();
+}
+
+void UGraspData::PostLoad()
+{
+	Super::PostLoad();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		FGraspDataRuntimeTable::Get().Register(this);
+	}
+}
+
+void UGraspData::BeginDestroy()
+{
+	if (RuntimeIndex != INDEX_NONE)
+	{
+		FGraspDataRuntimeTable::Get().Release(this);
+	}
+
+	Super::BeginDestroy();
+}
+
+void UGraspData::RequestAsyncLoadGraspAbility() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspData::RequestAsyncLoadGraspAbility);
+
+	// Already loaded by something else, the runtime entry still considers it pending
+	if (!IsGraspAbilityLoadPending())
+	{
+		FGraspDataRuntimeTable::Get().Compile(this);
+		return;
+	}
+
+	// Already loading
+	if (GraspAbilityLoadHandle.IsValid())
+	{
+		return;
+	}
+
+	UE_LOG(LogGrasp, Verbose, TEXT("GraspData::RequestAsyncLoadGraspAbility: %s requesting %s"),
+		*GetName(), *SoftGraspAbility.ToString());
+
+	GraspAbilityLoadRequestTime = FPlatformTime::Seconds();
+	GraspAbilityLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftGraspAbility.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::OnGraspAbilityLoaded), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UGraspData::OnGraspAbilityLoaded() const
+{
+	const double LoadTimeMs = (FPlatformTime::Seconds() - GraspAbilityLoadRequestTime) * 1000.0;
+	if (SoftGraspAbility.Get())
+	{
+		UE_LOG(LogGrasp, Verbose, TEXT("GraspData::OnGraspAbilityLoaded: %s loaded %s in %.2fms"),
+			*GetName(), *SoftGraspAbility.ToString(), LoadTimeMs);
+
+		// Resolve the ability for the hot paths
+		FGraspDataRuntimeTable::Get().Compile(this);
+	}
+	else
+	{
+		// Release the handle so a later scan can retry
+		UE_LOG(LogGrasp, Warning, TEXT("GraspData::OnGraspAbilityLoaded: %s failed to load %s"),
+			*GetName(), *SoftGraspAbility.ToString());
+		GraspAbilityLoadHandle.Reset();
+	}
 }
 
 #if WITH_EDITOR
@@ -35,6 +107,8 @@ void UGraspData::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyCh
 			MaxHighlightDistance = FMath::Max(MaxHighlightDistance, MaxGraspDistance);
 		}
 	}
+
+	FGraspDataRuntimeTable::Get().Compile(this);
 }
 
 EDataValidationResult UGraspData::IsDataValid(class FDataValidationContext& Context) const
@@ -54,6 +128,19 @@ EDataValidationResult UGraspData::IsDataValid(class FDataValidationContext& Cont
 		return EDataValidationResult::Invalid;
 	}
 	
+	// GraspAbility takes precedence, SoftGraspAbility will never be used
+	if (GraspAbility && !SoftGraspAbility.IsNull())
+	{
+		Context.AddWarning(NSLOCTEXT("GraspData", "RedundantSoftGraspAbility", "SoftGraspAbility is ignored because GraspAbility is set"));
+	}
+
+	// Persistent abilities are never granted by scanning, there must be one to pre-grant
+	if (bPersistentAbility && !GraspAbility && SoftGraspAbility.IsNull())
+	{
+		Context.AddError(NSLOCTEXT("GraspData", "InvalidPersistentAbility", "bPersistentAbility requires GraspAbility or SoftGraspAbility to be set and added to UGraspComponent::CommonGraspAbilities"));
+		return EDataValidationResult::Invalid;
+	}
+	
 	return Super::IsDataValid(Context);
 }
 #endif
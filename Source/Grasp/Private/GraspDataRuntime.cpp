@@ -0,0 +1,121 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspDataRuntime.h"
+
+#include "GraspData.h"
+#include "GraspStats.h"
+#include "Abilities/GameplayAbility.h"
+
+
+TSubclassOf<UGameplayAbility> FGraspDataRuntime::GetGraspAbility() const
+{
+	if (bDynamicAbility && Source)
+	{
+		return Source->GetGraspAbility();
+	}
+	return Ability;
+}
+
+FGraspDataRuntimeTable& FGraspDataRuntimeTable::Get()
+{
+	static FGraspDataRuntimeTable Table;
+	return Table;
+}
+
+int32 FGraspDataRuntimeTable::Register(const UGraspData* Data)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspDataRuntimeTable::Register);
+
+	check(IsInGameThread());
+	LLM_SCOPE_BYTAG(Grasp);
+
+	if (!Data)
+	{
+		return INDEX_NONE;
+	}
+
+	// Already registered
+	if (IsValidEntry(Data->RuntimeIndex, Data))
+	{
+		return Data->RuntimeIndex;
+	}
+
+	const int32 Index = FreeIndices.Num() > 0 ? FreeIndices.Pop() : Entries.AddDefaulted();
+	CompileEntry(Data, Entries[Index]);
+	Data->RuntimeIndex = Index;
+	UpdateMaxRange();
+
+	UE_LOG(LogGrasp, VeryVerbose, TEXT("GraspDataRuntimeTable::Register: %s at index %d"), *Data->GetName(), Index);
+
+	return Index;
+}
+
+void FGraspDataRuntimeTable::Compile(const UGraspData* Data)
+{
+	check(IsInGameThread());
+
+	if (Data && IsValidEntry(Data->RuntimeIndex, Data))
+	{
+		CompileEntry(Data, Entries[Data->RuntimeIndex]);
+		UpdateMaxRange();
+	}
+}
+
+void FGraspDataRuntimeTable::Release(const UGraspData* Data)
+{
+	check(IsInGameThread());
+
+	if (!Data || !IsValidEntry(Data->RuntimeIndex, Data))
+	{
+		return;
+	}
+
+	Entries[Data->RuntimeIndex] = FGraspDataRuntime();
+	FreeIndices.Add(Data->RuntimeIndex);
+	Data->RuntimeIndex = INDEX_NONE;
+	UpdateMaxRange();
+}
+
+void FGraspDataRuntimeTable::UpdateMaxRange()
+{
+	// Released entries are reset, so their distances are zero
+	MaxRangeSq[0] = MaxRangeSq[1] = 0.f;
+	for (const FGraspDataRuntime& Entry : Entries)
+	{
+		for (int32 i = 0; i < 2; i++)
+		{
+			MaxRangeSq[i] = FMath::Max3(MaxRangeSq[i], Entry.GraspDistanceSq[i], Entry.HighlightDistanceSq[i]);
+		}
+	}
+}
+
+void FGraspDataRuntimeTable::CompileEntry(const UGraspData* Data, FGraspDataRuntime& Entry)
+{
+	const float AngleScalar[2] = { 1.f, Data->GetAuthNetToleranceAngleScalar() };
+	const float DistanceScalar[2] = { 1.f, Data->GetAuthNetToleranceDistanceScalar() };
+
+	for (int32 i = 0; i < 2; i++)
+	{
+		Entry.GraspDistanceSq[i] = FMath::Square(Data->MaxGraspDistance * DistanceScalar[i]);
+		Entry.HighlightDistanceSq[i] = Data->MaxHighlightDistance > 0.f ?
+			FMath::Square(Data->MaxHighlightDistance * DistanceScalar[i]) : 0.f;
+		Entry.MaxHeightAbove[i] = Data->MaxHeightAbove * DistanceScalar[i];
+		Entry.MaxHeightBelow[i] = Data->MaxHeightBelow * DistanceScalar[i];
+
+		// Acos(Dot) <= HalfAngle is equivalent to Dot >= Cos(HalfAngle), anything at or beyond a half circle always passes
+		const float HalfAngle = FMath::DegreesToRadians(Data->MaxGraspAngle * AngleScalar[i] * 0.5f);
+		Entry.CosHalfAngle[i] = HalfAngle >= UE_PI ? -2.f : FMath::Cos(HalfAngle);
+	}
+
+	Entry.NormalizedGrantAbilityDistance = Data->NormalizedGrantAbilityDistance;
+	Entry.bManualClearAbility = Data->bManualClearAbility;
+	Entry.bGrantAbilityDistance2D = Data->bGrantAbilityDistance2D;
+	Entry.bGraspDistance2D = Data->bGraspDistance2D;
+	Entry.bAbilityLoadPending = Data->IsGraspAbilityLoadPending();
+	Entry.bPersistentAbility = Data->bPersistentAbility;
+	Entry.bCanActivateWithoutTargetData = Data->bCanActivateWithoutTargetData;
+	Entry.bDynamicAbility = Data->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UGraspData, GetGraspAbility));
+	Entry.Ability = Entry.bDynamicAbility ? nullptr : Data->GetGraspAbility();
+	Entry.Source = Data;
+}
@@ -0,0 +1,147 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspEventLog.h"
+
+#include "GraspStats.h"
+#include "GraspTypes.h"
+#include "Engine/World.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspEventLog)
+
+namespace FGraspCVars
+{
+	static bool bEventLog = true;
+	FAutoConsoleVariableRef CVarEventLog(
+		TEXT("p.Grasp.EventLog.Enable"),
+		bEventLog,
+		TEXT("Record scan and grant activity to the Grasp event log"),
+		ECVF_Default);
+
+	static int32 EventLogCapacity = 4096;
+	FAutoConsoleVariableRef CVarEventLogCapacity(
+		TEXT("p.Grasp.EventLog.Capacity"),
+		EventLogCapacity,
+		TEXT("Number of events kept by the Grasp event log, applied when the world is created"),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdEventLogDump(
+		TEXT("p.Grasp.EventLog.Dump"),
+		TEXT("Write the Grasp event log for this world to a csv file. Optionally pass the filename, defaults to the project log directory"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const UGraspEventLog* EventLog = World ? World->GetSubsystem<UGraspEventLog>() : nullptr;
+			if (!EventLog)
+			{
+				UE_LOG(LogGrasp, Warning, TEXT("p.Grasp.EventLog.Dump: No event log for this world"));
+				return;
+			}
+
+			const FString Filename = Args.Num() > 0 ? Args[0] : FPaths::ProjectLogDir() /
+				FString::Printf(TEXT("GraspEventLog-%s-%s.csv"), *World->GetName(), *FDateTime::Now().ToString());
+
+			if (EventLog->DumpToFile(Filename))
+			{
+				UE_LOG(LogGrasp, Log, TEXT("p.Grasp.EventLog.Dump: Wrote %d events to %s"), EventLog->Num(), *Filename);
+			}
+			else
+			{
+				UE_LOG(LogGrasp, Warning, TEXT("p.Grasp.EventLog.Dump: Failed to write %s"), *Filename);
+			}
+		}));
+}
+
+void UGraspEventLog::Record(const UObject* WorldContext, EGraspEventType Type, const UObject* Source,
+	const UObject* Target, FName Tag, int32 Value)
+{
+	if (!FGraspCVars::bEventLog || !WorldContext)
+	{
+		return;
+	}
+
+	if (const UWorld* World = WorldContext->GetWorld())
+	{
+		if (UGraspEventLog* EventLog = World->GetSubsystem<UGraspEventLog>())
+		{
+			EventLog->Add(Type, Source, Target, Tag, Value);
+		}
+	}
+}
+
+namespace GraspEventLog
+{
+	/** Outer.Name, or just Name if there is no outer */
+	static FString GetEventObjectName(FName Name, FName OuterName)
+	{
+		return OuterName.IsNone() ? Name.ToString() : FString::Printf(TEXT("%s.%s"), *OuterName.ToString(), *Name.ToString());
+	}
+}
+
+void UGraspEventLog::Add(EGraspEventType Type, const UObject* Source, const UObject* Target, FName Tag, int32 Value)
+{
+	if (Events.Num() == 0)
+	{
+		return;
+	}
+
+	FGraspEvent& Event = Events[Head];
+	Event.Time = GetWorld()->GetTimeSeconds();
+	Event.Source = Source;
+	Event.Target = Target;
+	Event.SourceName = Source ? Source->GetFName() : NAME_None;
+	Event.SourceOuterName = Source && Source->GetOuter() ? Source->GetOuter()->GetFName() : NAME_None;
+	Event.TargetName = Target ? Target->GetFName() : NAME_None;
+	Event.TargetOuterName = Target && Target->GetOuter() ? Target->GetOuter()->GetFName() : NAME_None;
+	Event.Tag = Tag;
+	Event.Value = Value;
+	Event.Type = Type;
+
+	Head = (Head + 1) % Events.Num();
+	Count = FMath::Min(Count + 1, Events.Num());
+}
+
+void UGraspEventLog::ForEachEvent(TFunctionRef<void(const FGraspEvent&)> Func) const
+{
+	const int32 Oldest = (Head - Count + Events.Num()) % FMath::Max(Events.Num(), 1);
+	for (int32 i = 0; i < Count; i++)
+	{
+		Func(Events[(Oldest + i) % Events.Num()]);
+	}
+}
+
+bool UGraspEventLog::DumpToFile(const FString& Filename) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspEventLog::DumpToFile);
+
+	const UEnum* TypeEnum = StaticEnum<EGraspEventType>();
+
+	FString Output = TEXT("Time,Type,Source,Target,Tag,Value\n");
+	ForEachEvent([&](const FGraspEvent& Event)
+	{
+		// Names were captured when recorded, objects that have since been destroyed are still named
+		Output += FString::Printf(TEXT("%.4f,%s,%s,%s,%s,%d\n"), Event.Time,
+			*TypeEnum->GetNameStringByValue(static_cast<int64>(Event.Type)),
+			*GraspEventLog::GetEventObjectName(Event.SourceName, Event.SourceOuterName),
+			*GraspEventLog::GetEventObjectName(Event.TargetName, Event.TargetOuterName),
+			*Event.Tag.ToString(), Event.Value);
+	});
+
+	return FFileHelper::SaveStringToFile(Output, *Filename);
+}
+
+bool UGraspEventLog::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGraspEventLog::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LLM_SCOPE_BYTAG(Grasp);
+	Events.SetNum(FMath::Max(FGraspCVars::EventLogCapacity, 0));
+	Head = 0;
+	Count = 0;
+}
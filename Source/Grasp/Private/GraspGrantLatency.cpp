@@ -0,0 +1,359 @@
+﻿// Copyright (c) Jared Taylor
+
+#include "GraspGrantLatency.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "AbilitySystemComponent.h"
+#include "GraspComponent.h"
+#include "GraspStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+
+namespace FGraspCVars
+{
+	static bool bGrantLatencyEnabled = false;
+	FAutoConsoleVariableRef CVarGrantLatencyEnabled(
+		TEXT("p.Grasp.Latency.Enable"),
+		bGrantLatencyEnabled,
+		TEXT("Record the latency from entering grant range to the ability arriving on the owning client, see p.Grasp.Latency.Report. Grants to clients outside this process can't resolve, leave this off on dedicated servers."),
+		ECVF_Default);
+
+	static float GrantLatencyTimeout = 5.f;
+	FAutoConsoleVariableRef CVarGrantLatencyTimeout(
+		TEXT("p.Grasp.Latency.Timeout"),
+		GrantLatencyTimeout,
+		TEXT("World seconds to wait for a granted spec to arrive on the owning client before it is counted as unresolved."),
+		ECVF_Default);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CGrantLatencyReport(
+		TEXT("p.Grasp.Latency.Report"),
+		TEXT("Report the grant latency histograms for each map, in milliseconds."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			FGraspGrantLatency::Get().Log(Ar);
+		}));
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CGrantLatencyReset(
+		TEXT("p.Grasp.Latency.Reset"),
+		TEXT("Discard the grant latency samples. Optional: [Map], otherwise every map."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			FGraspGrantLatency::Get().Reset(Args.Num() > 0 ? Args[0] : FString());
+		}));
+}
+
+namespace GraspGrantLatency
+{
+	/** Something is reading the stats, e.g. stat Grasp */
+	static bool IsCollectingStats()
+	{
+#if STATS
+		return FThreadStats::IsCollectingData();
+#else
+		return false;
+#endif
+	}
+}
+
+void FGraspLatencyHistogram::Add(float Seconds)
+{
+	LLM_SCOPE_BYTAG(Grasp);
+
+	if (Samples.Num() < MaxSamples)
+	{
+		Samples.Add(Seconds);
+	}
+	else
+	{
+		Samples[Head] = Seconds;
+		Head = (Head + 1) % MaxSamples;
+	}
+	bSorted = false;
+}
+
+void FGraspLatencyHistogram::Reset()
+{
+	Samples.Reset();
+	Sorted.Reset();
+	Head = 0;
+	bSorted = false;
+}
+
+float FGraspLatencyHistogram::GetPercentile(float Percentile) const
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.f;
+	}
+
+	if (!bSorted)
+	{
+		LLM_SCOPE_BYTAG(Grasp);
+		Sorted = Samples;
+		Sorted.Sort();
+		bSorted = true;
+	}
+
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+	return Sorted[Index];
+}
+
+void FGraspLatencyHistogram::Log(FOutputDevice& Ar, const TCHAR* Label) const
+{
+	if (Samples.Num() == 0)
+	{
+		Ar.Logf(TEXT("  %s: no samples"), Label);
+		return;
+	}
+
+	Ar.Logf(TEXT("  %s: p50 %.1fms p95 %.1fms max %.1fms (%d samples)"), Label,
+		GetPercentile(0.5f) * 1000.f, GetPercentile(0.95f) * 1000.f, GetPercentile(1.f) * 1000.f, Samples.Num());
+
+	// 50ms bins up to a second, the last bin collects everything beyond
+	static constexpr int32 NumBins = 21;
+	static constexpr float BinSize = 0.05f;
+	int32 Bins[NumBins] = {};
+	for (const float Sample : Samples)
+	{
+		Bins[FMath::Clamp(FMath::FloorToInt(Sample / BinSize), 0, NumBins - 1)]++;
+	}
+
+	for (int32 i = 0; i < NumBins; i++)
+	{
+		if (Bins[i] == 0)
+		{
+			continue;
+		}
+
+		const FString Range = i < NumBins - 1 ?
+			FString::Printf(TEXT("%4d-%4dms"), FMath::RoundToInt(i * BinSize * 1000.f), FMath::RoundToInt((i + 1) * BinSize * 1000.f)) :
+			FString::Printf(TEXT("%9dms+"), FMath::RoundToInt(i * BinSize * 1000.f));
+		const int32 BarLength = FMath::Max(1, FMath::RoundToInt(40.f * Bins[i] / Samples.Num()));
+		Ar.Logf(TEXT("    %s %6d %s"), *Range, Bins[i], *FString::ChrN(BarLength, TEXT('#')));
+	}
+}
+
+FGraspGrantLatency& FGraspGrantLatency::Get()
+{
+	static FGraspGrantLatency Latency;
+	return Latency;
+}
+
+bool FGraspGrantLatency::IsEnabled()
+{
+	return FGraspCVars::bGrantLatencyEnabled;
+}
+
+void FGraspGrantLatency::SetEnabled(bool bEnabled)
+{
+	FGraspCVars::bGrantLatencyEnabled = bEnabled;
+}
+
+FString FGraspGrantLatency::GetMapName(const UWorld* World)
+{
+	return World ? UWorld::RemovePIEPrefix(World->GetMapName()) : FString();
+}
+
+void FGraspGrantLatency::OnGiveAbility(const UGraspComponent* GraspComponent, const FGameplayAbilitySpecHandle& Handle,
+	float EnterDelay)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspGrantLatency::OnGiveAbility);
+
+	check(IsInGameThread());
+	LLM_SCOPE_BYTAG(Grasp);
+
+	if (!GraspComponent || !Handle.IsValid())
+	{
+		return;
+	}
+
+	const FString MapName = GetMapName(GraspComponent->GetWorld());
+	FGraspMapGrantLatency& Latency = Maps.FindOrAdd(MapName);
+	Latency.ScanDelay.Add(EnterDelay);
+
+	// AI has no client to wait for
+	const APlayerController* PlayerController = Cast<APlayerController>(GraspComponent->GetOwner());
+	if (!PlayerController)
+	{
+		return;
+	}
+
+	// Listen server host or standalone, the spec is already activatable
+	if (PlayerController->IsLocalController())
+	{
+		Latency.Total.Add(EnterDelay);
+		OnTotalAdded(MapName);
+		return;
+	}
+
+	const UWorld* World = GraspComponent->GetWorld();
+	const double Now = World->GetTimeSeconds();
+	FPendingGrant& Grant = Pending.Add(Handle);
+	Grant.MapName = MapName;
+	Grant.World = World;
+	Grant.GiveTime = Now;
+	Grant.EnterTime = Now - EnterDelay;
+	StartTicker();
+}
+
+void FGraspGrantLatency::OnTotalAdded(const FString& MapName)
+{
+	StatsMapName = MapName;
+	bStatsDirty = true;
+
+	// Coalesce every total added this frame into a single update
+	if (GraspGrantLatency::IsCollectingStats())
+	{
+		StartTicker();
+	}
+}
+
+void FGraspGrantLatency::StartTicker()
+{
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGraspGrantLatency::Tick));
+	}
+}
+
+void FGraspGrantLatency::Reset(const FString& MapName)
+{
+	// Clear the stats too if they were showing what was discarded
+	if (MapName.IsEmpty() || MapName == StatsMapName)
+	{
+		bStatsDirty = true;
+		if (GraspGrantLatency::IsCollectingStats())
+		{
+			StartTicker();
+		}
+	}
+
+	if (MapName.IsEmpty())
+	{
+		Maps.Reset();
+		Pending.Reset();
+		NumUnresolved = 0;
+		return;
+	}
+
+	Maps.Remove(MapName);
+	for (auto It = Pending.CreateIterator(); It; ++It)
+	{
+		if (It->Value.MapName == MapName)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void FGraspGrantLatency::Log(FOutputDevice& Ar) const
+{
+	if (Maps.Num() == 0)
+	{
+		Ar.Logf(TEXT("No grant latency recorded, is p.Grasp.Latency.Enable set?"));
+		return;
+	}
+
+	for (const auto& Entry : Maps)
+	{
+		Ar.Logf(TEXT("%s"), *Entry.Key);
+		Entry.Value.ScanDelay.Log(Ar, TEXT("Scan Delay"));
+		Entry.Value.Replication.Log(Ar, TEXT("Replication"));
+		Entry.Value.Total.Log(Ar, TEXT("Total"));
+	}
+
+	Ar.Logf(TEXT("Pending: %d Unresolved: %d"), Pending.Num(), NumUnresolved);
+}
+
+bool FGraspGrantLatency::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspGrantLatency::Tick);
+
+	if (Pending.Num() > 0)
+	{
+		// Every client in this process, there is one world context per PIE instance
+		TArray<UAbilitySystemComponent*, TInlineAllocator<4>> ClientASCs;
+		if (GEngine)
+		{
+			for (const FWorldContext& Context : GEngine->GetWorldContexts())
+			{
+				const UWorld* World = Context.World();
+				if (!World || World->GetNetMode() != NM_Client)
+				{
+					continue;
+				}
+
+				const APlayerController* PlayerController = World->GetFirstPlayerController();
+				UGraspComponent* GraspComponent = PlayerController ? PlayerController->FindComponentByClass<UGraspComponent>() : nullptr;
+				if (UAbilitySystemComponent* ASC = GraspComponent ? GraspComponent->GetASC() : nullptr)
+				{
+					ClientASCs.Add(ASC);
+				}
+			}
+		}
+
+		for (auto It = Pending.CreateIterator(); It; ++It)
+		{
+			const FPendingGrant& Grant = It->Value;
+
+			// The server's world ended before the spec arrived
+			const UWorld* World = Grant.World.Get();
+			if (!World)
+			{
+				NumUnresolved++;
+				It.RemoveCurrent();
+				continue;
+			}
+
+			// Handles are assigned by the server and replicated, so they match on the owning client
+			const bool bArrived = ClientASCs.ContainsByPredicate([&It](UAbilitySystemComponent* ASC)
+			{
+				return ASC->FindAbilitySpecFromHandle(It->Key) != nullptr;
+			});
+
+			const double Now = World->GetTimeSeconds();
+			if (bArrived)
+			{
+				FGraspMapGrantLatency& Latency = Maps.FindOrAdd(Grant.MapName);
+				Latency.Replication.Add(Now - Grant.GiveTime);
+				Latency.Total.Add(Now - Grant.EnterTime);
+				OnTotalAdded(Grant.MapName);
+				It.RemoveCurrent();
+			}
+			else if (Now - Grant.GiveTime > FGraspCVars::GrantLatencyTimeout)
+			{
+				NumUnresolved++;
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Percentiles are only sorted for the stats while something is reading them, otherwise they stay dirty
+	// and are refreshed by the next tick that runs while they are read, the ticker isn't kept alive for them
+	if (bStatsDirty && GraspGrantLatency::IsCollectingStats())
+	{
+		UpdateStats();
+		bStatsDirty = false;
+	}
+
+	if (Pending.Num() == 0)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FGraspGrantLatency::UpdateStats()
+{
+#if STATS
+	const FGraspMapGrantLatency* Latency = Maps.Find(StatsMapName);
+	SET_FLOAT_STAT(STAT_GraspGrantLatencyP50, Latency ? Latency->Total.GetPercentile(0.5f) * 1000.f : 0.f);
+	SET_FLOAT_STAT(STAT_GraspGrantLatencyP95, Latency ? Latency->Total.GetPercentile(0.95f) * 1000.f : 0.f);
+#endif
+}
+
+#endif
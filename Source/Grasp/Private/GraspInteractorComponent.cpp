@@ -0,0 +1,348 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspInteractorComponent.h"
+
+#include "GraspableComponent.h"
+#include "GraspableOwner.h"
+#include "GraspScanWatchdog.h"
+#include "GraspStatics.h"
+#include "Targeting/GraspTargetingRequestData.h"
+#include "Targeting/GraspTargetingStatics.h"
+#include "TargetingSystem/TargetingSubsystem.h"
+#include "TargetingSystem/TargetingPreset.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "TimerManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspInteractorComponent)
+
+
+UGraspInteractorComponent::UGraspInteractorComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// No ticking or replication, ever
+	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.bAllowTickOnDedicatedServer = false;
+
+	SetIsReplicatedByDefault(false);
+}
+
+void UGraspInteractorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	bGraspPaused = true;
+	EndAllTargetingRequests();
+
+	if (IsValid(GetWorld()))
+	{
+		GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UGraspInteractorComponent::InitializeGraspInteractor()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::InitializeGraspInteractor);
+
+	if (!IsValid(GetOwner()) || !IsValid(GetWorld()))
+	{
+		return;
+	}
+
+	// Cache the owning controller
+	Controller = Cast<AController>(GetOwner());
+
+	// Restart scanning from a clean state
+	EndAllTargetingRequests();
+	GetWorld()->GetTimerManager().ClearTimer(GraspWaitTimer);
+
+	CurrentTargetingPresets = DefaultTargetingPresets;
+	CurrentScanResults.Reset();
+	bGraspPaused = false;
+
+	RequestGrasp();
+}
+
+AActor* UGraspInteractorComponent::GetTargetingSource() const
+{
+	switch (DefaultTargetingSource)
+	{
+	case EGraspTargetingSource::Pawn: return Controller ? Controller->GetPawn() : nullptr;
+	case EGraspTargetingSource::PawnIfValid:
+		{
+			if (Controller && Controller->GetPawn())
+			{
+				return Controller->GetPawn();
+			}
+			return Controller;
+		}
+	case EGraspTargetingSource::Controller: return Controller;
+	}
+	return nullptr;
+}
+
+bool UGraspInteractorComponent::TryGraspInteract(UPrimitiveComponent* GraspableComponent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::TryGraspInteract);
+
+	if (!IsValid(GraspableComponent) || !Cast<IGraspableComponent>(GraspableComponent))
+	{
+		return false;
+	}
+
+	// Interaction is routed through the owner, there is nothing to call otherwise
+	AActor* GraspableOwner = GraspableComponent->GetOwner();
+	if (!IsValid(GraspableOwner) || !GraspableOwner->Implements<UGraspableOwner>())
+	{
+		UE_LOG(LogGrasp, Warning, TEXT("GraspInteractorComponent::TryGraspInteract: %s owner %s does not implement IGraspableOwner"),
+			*GraspableComponent->GetName(), *GetNameSafe(GraspableOwner));
+		return false;
+	}
+
+	AActor* Interactor = GetTargetingSource();
+	if (!IsValid(Interactor))
+	{
+		return false;
+	}
+
+	// Optionally require the graspable to be within interact range
+	if (bRequireInteractRange)
+	{
+		float NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance = 0.f;
+		const EGraspQueryResult Result = UGraspStatics::CanInteractWith(Interactor, GraspableComponent,
+			NormalizedAngleDiff, NormalizedDistance, NormalizedHighlightDistance);
+		if (Result != EGraspQueryResult::Interact)
+		{
+			return false;
+		}
+	}
+
+	if (!IGraspableOwner::Execute_CanGraspInteract(GraspableOwner, Interactor, GraspableComponent))
+	{
+		return false;
+	}
+
+	return IGraspableOwner::Execute_OnGraspInteract(GraspableOwner, Interactor, GraspableComponent);
+}
+
+bool UGraspInteractorComponent::CanGraspInteract(const UPrimitiveComponent* GraspableComponent) const
+{
+	const AActor* GraspableOwner = GraspableComponent ? GraspableComponent->GetOwner() : nullptr;
+	if (!IsValid(GraspableOwner) || !GraspableOwner->Implements<UGraspableOwner>())
+	{
+		return false;
+	}
+
+	return IGraspableOwner::Execute_CanGraspInteract(GraspableOwner, GetTargetingSource(), GraspableComponent);
+}
+
+void UGraspInteractorComponent::PauseGrasp(bool bPaused)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::PauseGrasp);
+
+	if (bGraspPaused == bPaused)
+	{
+		return;
+	}
+
+	bGraspPaused = bPaused;
+	if (bPaused)
+	{
+		EndAllTargetingRequests();
+		if (IsValid(GetWorld()))
+		{
+			GetWorld()->GetTimerManager().ClearTimer(GraspWaitTimer);
+		}
+	}
+	else
+	{
+		RequestGrasp();
+	}
+}
+
+void UGraspInteractorComponent::EndAllTargetingRequests()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::EndAllTargetingRequests);
+
+	if (IsValid(GetWorld()) && IsValid(GetWorld()->GetGameInstance()))
+	{
+		if (UTargetingSubsystem* TargetSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UTargetingSubsystem>())
+		{
+			for (const auto& Request : TargetingRequests)
+			{
+				TargetSubsystem->RemoveAsyncTargetingRequestWithHandle(Request.Value);
+				FGraspTargetingRequestData::Remove(Request.Value);
+			}
+		}
+	}
+
+	TargetingRequests.Reset();
+	UpdateWatchdog();
+}
+
+bool UGraspInteractorComponent::RecoverFromHang()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::RecoverFromHang);
+
+	// The TargetingSubsystem lost our requests, see UGraspScanTask::RecoverFromHang()
+	if (bGraspPaused || TargetingRequests.Num() == 0)
+	{
+		return false;
+	}
+
+	UE_LOG(LogGrasp, Error, TEXT("GraspInteractorComponent %s hung with %d targeting requests. Retrying..."),
+		*GetNameSafe(GetOwner()), TargetingRequests.Num());
+	EndAllTargetingRequests();
+	RequestGrasp();
+	return true;
+}
+
+void UGraspInteractorComponent::UpdateWatchdog()
+{
+	UGraspScanWatchdog* Watchdog = GetWorld() ? GetWorld()->GetSubsystem<UGraspScanWatchdog>() : nullptr;
+	if (!Watchdog)
+	{
+		return;
+	}
+
+	if (TargetingRequests.Num() > 0)
+	{
+		Watchdog->Watch(this, FailsafeDelay);
+	}
+	else
+	{
+		Watchdog->Unwatch(this);
+	}
+}
+
+void UGraspInteractorComponent::WaitForGrasp(float Delay)
+{
+	if (IsValid(GetWorld()))
+	{
+		GetWorld()->GetTimerManager().SetTimer(GraspWaitTimer, this, &ThisClass::RequestGrasp, FMath::Max(Delay, UE_KINDA_SMALL_NUMBER), false);
+	}
+}
+
+void UGraspInteractorComponent::RequestGrasp()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::RequestGrasp);
+
+	UWorld* World = GetWorld();
+	if (bGraspPaused || !IsValid(World))
+	{
+		return;
+	}
+
+	// Don't re-enter while requests are still pending
+	if (TargetingRequests.Num() > 0)
+	{
+		return;
+	}
+
+	// Are we on cooldown due to rate throttling?
+	if (MaxGraspScanRate > 0.f)
+	{
+		const float TimeSince = World->TimeSince(LastGraspScanTime);
+		if (TimeSince < MaxGraspScanRate)
+		{
+			WaitForGrasp(MaxGraspScanRate - TimeSince);
+			return;
+		}
+		LastGraspScanTime = World->GetTimeSeconds();
+	}
+
+	UTargetingSubsystem* TargetSubsystem = World->GetGameInstance() ? World->GetGameInstance()->GetSubsystem<UTargetingSubsystem>() : nullptr;
+	if (!TargetSubsystem)
+	{
+		UE_LOG(LogGrasp, Verbose, TEXT("GraspInteractorComponent::RequestGrasp: Invalid TargetingSubsystem. [SYSTEM WAIT]"));
+		WaitForGrasp(ErrorWaitDelay);
+		return;
+	}
+
+	AActor* TargetingSource = GetTargetingSource();
+	if (!TargetingSource)
+	{
+		UE_LOG(LogGrasp, Verbose, TEXT("GraspInteractorComponent::RequestGrasp: Invalid TargetingSource. Did you call InitializeGraspInteractor()? [SYSTEM WAIT]"));
+		WaitForGrasp(ErrorWaitDelay);
+		return;
+	}
+
+	for (const auto& Entry : CurrentTargetingPresets)
+	{
+		const FGameplayTag& Tag = Entry.Key;
+		const UTargetingPreset* Preset = Entry.Value;
+
+		if (!Preset || !Preset->GetTargetingTaskSet() || Preset->GetTargetingTaskSet()->Tasks.IsEmpty())
+		{
+			continue;
+		}
+
+		FTargetingRequestHandle& Handle = TargetingRequests.FindOrAdd(Tag);
+		Handle = TargetSubsystem->MakeTargetRequestHandle(Preset, FTargetingSourceContext{TargetingSource});
+
+		FTargetingAsyncTaskData& AsyncTaskData = FTargetingAsyncTaskData::FindOrAdd(Handle);
+		AsyncTaskData.bReleaseOnCompletion = true;
+
+		// Lets the selection record that it sorted the results, so the range filters can stop at the max range
+		FGraspTargetingRequestData::FindOrAdd(Handle);
+
+		TargetSubsystem->StartAsyncTargetingRequestWithHandle(Handle,
+			FTargetingRequestDelegate::CreateUObject(this, &ThisClass::OnGraspComplete, Tag));
+	}
+
+	if (TargetingRequests.Num() == 0)
+	{
+		UE_LOG(LogGrasp, Verbose, TEXT("GraspInteractorComponent::RequestGrasp: TargetingTaskSet(s) are empty or no Preset assigned! Bad setup! [SYSTEM WAIT]"));
+		WaitForGrasp(ErrorWaitDelay);
+		return;
+	}
+
+	// In case the TargetingSubsystem loses our requests
+	UpdateWatchdog();
+}
+
+void UGraspInteractorComponent::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FGameplayTag ScanTag)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::OnGraspComplete);
+
+	TArray<FGraspScanResult> ScanResults;
+	if (TargetingHandle.IsValid())
+	{
+		UGraspTargetingStatics::GetGraspScanResults(TargetingHandle, ScanTag, ScanResults);
+		FGraspTargetingRequestData::Remove(TargetingHandle);
+
+		// Remove the request handle
+		TargetingRequests.Remove(ScanTag);
+	}
+
+	// Progress was made, or nothing remains in flight
+	UpdateWatchdog();
+
+	GraspTargetsReady(ScanTag, ScanResults);
+
+	// Request the next Grasp once all presets have completed
+	if (TargetingRequests.Num() == 0)
+	{
+		RequestGrasp();
+	}
+}
+
+void UGraspInteractorComponent::GraspTargetsReady(const FGameplayTag& ScanTag,
+	const TArray<FGraspScanResult>& Results)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspInteractorComponent::GraspTargetsReady);
+
+	// Replace the results for this preset only
+	CurrentScanResults.RemoveAll([&ScanTag](const FGraspScanResult& Result)
+	{
+		return Result.ScanTag == ScanTag;
+	});
+	CurrentScanResults.Append(Results);
+
+	OnGraspTargetsReady.Broadcast(this, Results);
+}
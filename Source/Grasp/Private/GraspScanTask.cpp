@@ -14,6 +14,7 @@
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "TimerManager.h"
+#include "Misc/ScopeExit.h"
 
 #if !UE_BUILD_SHIPPING
 #include "Logging/MessageLog.h"
@@ -22,6 +23,11 @@
 #include "GraspableComponent.h"
 #include "GraspData.h"
 #include "GraspDeveloper.h"
+#include "GraspEventLog.h"
+#include "GraspScanWatchdog.h"
+#include "GraspStats.h"
+#include "Targeting/GraspNativeScan.h"
+#include "Targeting/GraspTargetingStatics.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspScanTask)
 
@@ -112,6 +118,18 @@ void UGraspScanTask::WaitForGrasp(float InDelay, const TOptional<FString>& Reaso
 void UGraspScanTask::RequestGrasp()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspScanTask::RequestGrasp);
+	SCOPE_CYCLE_COUNTER(STAT_GraspRequestGrasp);
+	LLM_SCOPE_BYTAG(Grasp);
+
+	// Cost graph for the Gameplay Debugger
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	ON_SCOPE_EXIT
+	{
+		if (GC.IsValid() && GC->IsCollectingScanDebugInfo())
+		{
+			GC->AddScanDebugCost(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+		}
+	};
 
 	// Print the last reason we waited, if set
 	if (WaitReason.IsSet())
@@ -218,7 +236,7 @@ void UGraspScanTask::RequestGrasp()
 	check(GC.IsValid());
 
 	// Are we on cooldown due to rate throttling?
-	const float MaxRate = GC->GetMaxGraspScanRate();
+	const float MaxRate = GC->GetCachedMaxGraspScanRate();
 	if (FGraspCVars::bLogVeryVerboseScanRequest)
 	{
 		UE_LOG(LogGrasp, VeryVerbose, TEXT("%s GraspScanTask::RequestGrasp: MaxRate: %.2f"), *GetRoleString(), MaxRate);
@@ -264,7 +282,7 @@ void UGraspScanTask::RequestGrasp()
 		return;
 	}
 
-	AActor* TargetingSource = GC->GetTargetingSource();
+	AActor* TargetingSource = GC->GetCachedTargetingSource();
 	if (!TargetingSource)
 	{
 		UE_LOG(LogGrasp, Verbose, TEXT("%s GraspScanTask::RequestGrasp: Invalid TargetingSource. Did you call InitializeGrasp()? [SYSTEM WAIT]"),
@@ -283,8 +301,8 @@ void UGraspScanTask::RequestGrasp()
 		GC->bLastUpdateTargetingPresetsOnPawnChange = GC->bUpdateTargetingPresetsOnPawnChange;
 	}
 
-	// Optionally update the targeting presets
-	if (GC->bUpdateTargetingPresetsOnUpdate)
+	// Update the targeting presets if invalidated, or optionally every request
+	if (GC->AreTargetingPresetsDirty() || GC->bUpdateTargetingPresetsOnUpdate)
 	{
 		UE_LOG(LogGrasp, Verbose, TEXT("%s GraspScanTask::RequestGrasp: Updating targeting presets."),
 		       *GetRoleString());
@@ -309,6 +327,7 @@ void UGraspScanTask::RequestGrasp()
 	}
 
 	bool bAwaitingCallback = false;
+	TArray<TPair<FGameplayTag, const UTargetingPreset*>, TInlineAllocator<4>> NativePresets;
 	for (const auto& Entry : TargetingPresets)
 	{
 		const FGameplayTag& Tag = Entry.Key;
@@ -320,13 +339,21 @@ void UGraspScanTask::RequestGrasp()
 			continue;
 		}
 
-		FTargetingRequestHandle& Handle = GC->TargetingRequests.FindOrAdd(Tag);
-		Handle = TargetSubsystem->MakeTargetRequestHandle(Preset, FTargetingSourceContext{TargetingSource});
+		// Run after the async requests have started, GraspTargetsReady() could change the presets
+		if (GC->ScanBackend == EGraspScanBackend::Native && FGraspNativeScan::IsCompatible(Preset))
+		{
+			NativePresets.Emplace(Tag, Preset);
+			continue;
+		}
 
-		FTargetingAsyncTaskData& AsyncTaskData = FTargetingAsyncTaskData::FindOrAdd(Handle);
-		AsyncTaskData.bReleaseOnCompletion = true;
+		FTargetingRequestHandle& Handle = GC->TargetingRequests.FindOrAdd(Tag);
+		Handle = GC->AcquireTargetingRequestHandle(TargetSubsystem, Tag, Preset, TargetingSource);
+		GC->PrepareScanLODRequest(Tag, Handle);
 
 		bAwaitingCallback = true;
+		INC_DWORD_STAT(STAT_GraspScanRequests);
+		CSV_CUSTOM_STAT(Grasp, Scans, 1, ECsvCustomStatOp::Accumulate);
+		UGraspEventLog::Record(this, EGraspEventType::ScanIssued, GC.Get(), nullptr, Tag.GetTagName());
 
 		TargetSubsystem->StartAsyncTargetingRequestWithHandle(Handle,
 			FTargetingRequestDelegate::CreateUObject(this, &ThisClass::OnGraspComplete, Tag));
@@ -339,6 +366,45 @@ void UGraspScanTask::RequestGrasp()
 		}
 	}
 
+	// Native scans complete immediately
+	for (const TPair<FGameplayTag, const UTargetingPreset*>& Entry : NativePresets)
+	{
+		const FGameplayTag& Tag = Entry.Key;
+		const UTargetingPreset* Preset = Entry.Value;
+
+		FTargetingRequestHandle Handle = GC->AcquireTargetingRequestHandle(TargetSubsystem, Tag, Preset, TargetingSource);
+		GC->PrepareScanLODRequest(Tag, Handle);
+
+		TArray<FGraspScanResult> ScanResults;
+		FGraspNativeScan::Execute(Preset, Handle, Tag, ScanResults);
+		GC->CompleteScanLODRequest(Tag, Handle);
+		INC_DWORD_STAT(STAT_GraspNativeScans);
+		CSV_CUSTOM_STAT(Grasp, Scans, 1, ECsvCustomStatOp::Accumulate);
+		UGraspEventLog::Record(this, EGraspEventType::NativeScan, GC.Get(), nullptr, Tag.GetTagName(), ScanResults.Num());
+
+		// Never queued, so the subsystem won't release it
+		if (!GC->bReuseTargetingRequestHandles)
+		{
+			UTargetingSubsystem::ReleaseTargetRequestHandle(Handle);
+		}
+
+		if (FGraspCVars::bLogVeryVerboseScanRequest)
+		{
+			UE_LOG(LogGrasp, VeryVerbose,
+				   TEXT("%s GraspScanTask::RequestGrasp: Native scan for TargetingPresets[%s]: %s, broadcasting %d results."),
+				   *GetRoleString(), *Tag.ToString(), *GetNameSafe(Preset), ScanResults.Num());
+		}
+
+		GC->GraspTargetsReady(Tag, ScanResults);
+	}
+
+	// Only native scans ran, nothing will call back so schedule the next Grasp ourselves
+	if (!bAwaitingCallback && NativePresets.Num() > 0)
+	{
+		WaitForGrasp(FMath::Max(MaxRate, UE_KINDA_SMALL_NUMBER), {}, {"Native Scan Complete"});
+		return;
+	}
+
 	if (!bAwaitingCallback)
 	{
 		// Failed to start any async targeting requests
@@ -350,6 +416,8 @@ void UGraspScanTask::RequestGrasp()
 		return;
 	}
 
+	UpdateWatchdog();
+
 #if UE_ENABLE_DEBUG_DRAWING
 	if (IsInGameThread() && GEngine && Ability && Ability->GetCurrentActorInfo())
 	{
@@ -371,6 +439,7 @@ void UGraspScanTask::RequestGrasp()
 void UGraspScanTask::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FGameplayTag ScanTag)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspScanTask::OnGraspComplete);
+	LLM_SCOPE_BYTAG(Grasp);
 
 	if (FGraspCVars::bLogVeryVerboseScanRequest)
 	{
@@ -411,38 +480,16 @@ void UGraspScanTask::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FG
 	TArray<FGraspScanResult> ScanResults;
 	if (TargetingHandle.IsValid())
 	{
-		// Process results
-		if (FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle))
-		{
-			for (FTargetingDefaultResultData& ResultData : Results->TargetResults)
-			{
-				FHitResult& Hit = ResultData.HitResult;
-
-				// Requires a valid component
-				if (!Hit.GetComponent())
-				{
-					continue;
-				}
-
-				const IGraspableComponent* Graspable = CastChecked<IGraspableComponent>(Hit.GetComponent());  // Filtering already checked the type and data
-				const FVector Location = Hit.GetComponent()->GetComponentLocation();
-
-				// Calculate the normalized distance
-				const float GraspAbilityRadius = Hit.Distance;  // Targeting output the GraspAbilityRadius as Distance
-				Hit.Distance = Graspable->GetGraspData()->bGrantAbilityDistance2D ?
-					FVector::Dist2D(Location, Hit.TraceStart) :
-					FVector::Dist(Location, Hit.TraceStart);
-				const float NormalizedDistance = Hit.Distance / GraspAbilityRadius;
-
-				// Add the result to the array
-				FGraspScanResult Result = { ScanTag, Hit.GetComponent(), NormalizedDistance };
-				ScanResults.Add(Result);
-			}
-		}
+		GC->CompleteScanLODRequest(ScanTag, TargetingHandle);
+		UGraspTargetingStatics::GetGraspScanResults(TargetingHandle, ScanTag, ScanResults);
 
 		// Remove the request handle
 		GC->TargetingRequests.Remove(ScanTag);
 	}
+	UGraspEventLog::Record(this, EGraspEventType::ScanCompleted, GC.Get(), nullptr, ScanTag.GetTagName(), ScanResults.Num());
+
+	// Any completion is progress, the watchdog only restarts scans that stop completing
+	UpdateWatchdog();
 
 	// Broadcast the results
 	if (FGraspCVars::bLogVeryVerboseScanRequest)
@@ -451,7 +498,7 @@ void UGraspScanTask::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FG
 			   ScanResults.Num());
 	}
 
-	GC->GraspTargetsReady(ScanResults);
+	GC->GraspTargetsReady(ScanTag, ScanResults);
 
 	// Don't request next grasp if requests are still pending -- otherwise we will re-enter RequestGrasp multiple times
 	if (GC->TargetingRequests.Num() == 0)
@@ -459,22 +506,43 @@ void UGraspScanTask::OnGraspComplete(FTargetingRequestHandle TargetingHandle, FG
 		// Request the next Grasp
 		RequestGrasp();
 	}
+}
 
-	// Fail-safe timer to ensure we don't hang indefinitely -- this occurs due to an engine bug where the TargetingSubsystem
-	// loses all of its requests when another player joins (so far confirmed for running under one process in PIE only)
-	auto OnFailsafeTimer = [this]
+bool UGraspScanTask::RecoverFromHang()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspScanTask::RecoverFromHang);
+
+	// This occurs due to an engine bug where the TargetingSubsystem loses all of its requests when another player joins
+	// (so far confirmed for running under one process in PIE only)
+	if (!GC.IsValid() || GC->TargetingRequests.Num() == 0)
 	{
-		if (GC.IsValid() && GC->TargetingRequests.Num() > 0)
-		{
-			UE_LOG(LogGrasp, Error, TEXT("%s GraspScanTask hung with %d targeting requests. Retrying..."), *GetRoleString(), GC->TargetingRequests.Num());
-			GC->EndAllTargetingRequests();
-			RequestGrasp();
-		}
-	};
+		return false;
+	}
+
+	UE_LOG(LogGrasp, Error, TEXT("%s GraspScanTask hung with %d targeting requests. Retrying..."), *GetRoleString(), GC->TargetingRequests.Num());
+	UGraspEventLog::Record(this, EGraspEventType::HangRecovered, GC.Get(), nullptr, NAME_None, GC->TargetingRequests.Num());
+	GC->EndAllTargetingRequests();
+	RequestGrasp();
+	return true;
+}
+
+void UGraspScanTask::UpdateWatchdog()
+{
+	// The watchdog holds us weakly, a task that outlives its world after UEngine::Browse (open map) is simply dropped
+	UGraspScanWatchdog* Watchdog = GetWorld() ? GetWorld()->GetSubsystem<UGraspScanWatchdog>() : nullptr;
+	if (!Watchdog)
+	{
+		return;
+	}
 
-	// Weak Lambda is used because OnDestroy isn't called at the correct point in the engine lifecycle after UEngine::Browse (open map)
-	GetWorld()->GetTimerManager().SetTimer(FailsafeTimer, FTimerDelegate::CreateWeakLambda(this, OnFailsafeTimer),
-		FailsafeDelay, false);
+	if (GC.IsValid() && GC->TargetingRequests.Num() > 0)
+	{
+		Watchdog->Watch(this, FailsafeDelay);
+	}
+	else
+	{
+		Watchdog->Unwatch(this);
+	}
 }
 
 void UGraspScanTask::OnPauseGrasp(bool bPaused)
@@ -483,6 +551,7 @@ void UGraspScanTask::OnPauseGrasp(bool bPaused)
 
 	UE_LOG(LogGrasp, Verbose, TEXT("%s GraspScanTask::OnPauseGrasp: %s"), *GetRoleString(),
 	       bPaused ? TEXT("Paused") : TEXT("Unpaused"));
+	UGraspEventLog::Record(this, bPaused ? EGraspEventType::Pause : EGraspEventType::Unpause, GC.Get());
 	if (bPaused)
 	{
 		// Cancel the current Grasp
@@ -523,6 +592,11 @@ void UGraspScanTask::OnDestroy(bool bInOwnerFinished)
 	{
 		GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
 
+		if (UGraspScanWatchdog* Watchdog = GetWorld()->GetSubsystem<UGraspScanWatchdog>())
+		{
+			Watchdog->Unwatch(this);
+		}
+
 		if (GC.IsValid())
 		{
 			if (GC->OnPauseGrasp.IsBoundToObject(this))
@@ -0,0 +1,102 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspScanWatchdog.h"
+
+#include "GraspScanWatchable.h"
+#include "GraspStats.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspScanWatchdog)
+
+namespace FGraspCVars
+{
+	static float WatchdogSweepInterval = 0.25f;
+	FAutoConsoleVariableRef CVarWatchdogSweepInterval(
+		TEXT("p.Grasp.Watchdog.SweepInterval"),
+		WatchdogSweepInterval,
+		TEXT("Seconds between sweeps for hung Grasp scans, applied when the world begins play"),
+		ECVF_Default);
+}
+
+void UGraspScanWatchdog::Watch(IGraspScanWatchable* Scan, float Timeout)
+{
+	LLM_SCOPE_BYTAG(Grasp);
+	const UWorld* World = GetWorld();
+	if (World && Scan)
+	{
+		FGraspScanWatch& Entry = Watches.FindOrAdd(Scan->_getUObject());
+		Entry.StartTime = World->GetTimeSeconds();
+		Entry.Timeout = Timeout;
+	}
+}
+
+void UGraspScanWatchdog::Unwatch(const IGraspScanWatchable* Scan)
+{
+	if (Scan)
+	{
+		Watches.Remove(Scan->_getUObject());
+	}
+}
+
+bool UGraspScanWatchdog::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGraspScanWatchdog::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	InWorld.GetTimerManager().SetTimer(SweepTimer, this, &ThisClass::Sweep,
+		FMath::Max(FGraspCVars::WatchdogSweepInterval, UE_KINDA_SMALL_NUMBER), true);
+}
+
+void UGraspScanWatchdog::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(SweepTimer);
+	}
+	Watches.Reset();
+
+	Super::Deinitialize();
+}
+
+void UGraspScanWatchdog::Sweep()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspScanWatchdog::Sweep);
+
+	if (Watches.Num() == 0)
+	{
+		return;
+	}
+
+	// Collect first, recovering restarts the scan which watches it again
+	const double Now = GetWorld()->GetTimeSeconds();
+	TArray<TWeakObjectPtr<UObject>, TInlineAllocator<8>> Hung;
+	for (auto It = Watches.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+		else if (Now - It->Value.StartTime >= It->Value.Timeout)
+		{
+			Hung.Add(It->Key);
+			It.RemoveCurrent();
+		}
+	}
+
+	for (const TWeakObjectPtr<UObject>& Scan : Hung)
+	{
+		IGraspScanWatchable* Watchable = Cast<IGraspScanWatchable>(Scan.Get());
+		if (Watchable && Watchable->RecoverFromHang())
+		{
+			NumHangsRecovered++;
+			INC_DWORD_STAT(STAT_GraspScanHangsRecovered);
+			CSV_CUSTOM_STAT(Grasp, HangsRecovered, 1, ECsvCustomStatOp::Accumulate);
+		}
+	}
+}
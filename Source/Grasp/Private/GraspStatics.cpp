@@ -8,7 +8,9 @@
 #include "Engine/Engine.h"
 #include "GraspableComponent.h"
 #include "GraspComponent.h"
+#include "GraspInteractorComponent.h"
 #include "GraspData.h"
+#include "GraspDataRuntime.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
@@ -34,13 +36,13 @@ FGameplayAbilitySpec* UGraspStatics::FindGraspAbilitySpec(const UAbilitySystemCo
 	const UPrimitiveComponent* GraspableComponent)
 {
 	const IGraspableComponent* Graspable = GraspableComponent ? CastChecked<IGraspableComponent>(GraspableComponent) : nullptr;
-	const TSubclassOf<UGameplayAbility>& GraspAbility = Graspable->GetGraspData()->GetGraspAbility();
-	return ASC->FindAbilitySpecFromClass(GraspAbility);
+	const FGraspDataRuntime* Runtime = Graspable ? Graspable->GetGraspDataRuntime() : nullptr;
+	return Runtime ? ASC->FindAbilitySpecFromClass(Runtime->GetGraspAbility()) : nullptr;
 }
 
 bool UGraspStatics::PrepareGraspAbilityDataPayload(const UPrimitiveComponent* GraspableComponent,
 	FGameplayEventData& Payload, const AActor* SourceActor, const FGameplayAbilityActorInfo* ActorInfo,
-	EGraspAbilityComponentSource Source)
+	EGraspAbilityComponentSource Source, bool bGatherTargetData)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::PrepareGraspAbilityDataPayload);
 	
@@ -52,22 +54,22 @@ bool UGraspStatics::PrepareGraspAbilityDataPayload(const UPrimitiveComponent* Gr
 		return false;
 	}
 
-	// We would have filtered if the type was invalid
-	const IGraspableComponent* Graspable = GraspableComponent ? CastChecked<IGraspableComponent>(GraspableComponent) : nullptr;
-
-	// Gather target data
-	TArray<FGameplayAbilityTargetData*> OptionalTargetData = Graspable->GatherOptionalGraspTargetData(ActorInfo);
-
-	// Gather from owner, if implemented
-	if (const IGraspableOwner* GraspableOwner = Cast<IGraspableOwner>(GraspableComponent->GetOwner()))
+	// Only the presence of target data matters when it isn't sent
+	if (!bGatherTargetData)
 	{
-		const TArray<FGameplayAbilityTargetData*> OwnerTargetData = GraspableOwner->GatherOptionalGraspTargetData(ActorInfo);
-		if (OwnerTargetData.Num() > 0)
+		if (Source == EGraspAbilityComponentSource::Automatic && !HasGraspTargetData(GraspableComponent, ActorInfo))
 		{
-			OptionalTargetData.Append(OwnerTargetData);
+			return false;
 		}
+
+		Payload.OptionalObject = GraspableComponent;
+		return true;
 	}
 
+	// Gather target data
+	FGraspTargetDataArray OptionalTargetData;
+	GatherGraspTargetData(GraspableComponent, ActorInfo, OptionalTargetData);
+
 	// We may only want to send the target data if we have it
 	if (OptionalTargetData.Num() == 0 && Source == EGraspAbilityComponentSource::Automatic)
 	{
@@ -86,6 +88,47 @@ bool UGraspStatics::PrepareGraspAbilityDataPayload(const UPrimitiveComponent* Gr
 	return true;
 }
 
+void UGraspStatics::GatherGraspTargetData(const UPrimitiveComponent* GraspableComponent,
+	const FGameplayAbilityActorInfo* ActorInfo, FGraspTargetDataArray& OutTargetData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GatherGraspTargetData);
+
+	// We would have filtered if the type was invalid
+	const IGraspableComponent* Graspable = GraspableComponent ? CastChecked<IGraspableComponent>(GraspableComponent) : nullptr;
+	if (!Graspable)
+	{
+		return;
+	}
+
+	Graspable->GatherOptionalGraspTargetDataInto(ActorInfo, OutTargetData);
+
+	// Gather from owner, if implemented
+	if (const IGraspableOwner* GraspableOwner = Cast<IGraspableOwner>(GraspableComponent->GetOwner()))
+	{
+		GraspableOwner->GatherOptionalGraspTargetDataInto(ActorInfo, OutTargetData);
+	}
+}
+
+bool UGraspStatics::HasGraspTargetData(const UPrimitiveComponent* GraspableComponent,
+	const FGameplayAbilityActorInfo* ActorInfo)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::HasGraspTargetData);
+
+	const IGraspableComponent* Graspable = GraspableComponent ? CastChecked<IGraspableComponent>(GraspableComponent) : nullptr;
+	if (!Graspable)
+	{
+		return false;
+	}
+
+	if (Graspable->HasOptionalGraspTargetData(ActorInfo))
+	{
+		return true;
+	}
+
+	const IGraspableOwner* GraspableOwner = Cast<IGraspableOwner>(GraspableComponent->GetOwner());
+	return GraspableOwner && GraspableOwner->HasOptionalGraspTargetData(ActorInfo);
+}
+
 const UGraspData* UGraspStatics::GetGraspData(const UPrimitiveComponent* GraspableComponent)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::GetGraspData);
@@ -162,20 +205,36 @@ bool UGraspStatics::CanGraspActivateAbility(const AActor* SourceActor, const UPr
 	{
 		return false;
 	}
+
+	// Persistent abilities are shared between GraspData, the component must always be sent with the event data
+	const FGraspDataRuntime* Runtime = CastChecked<IGraspableComponent>(GraspableComponent)->GetGraspDataRuntime();
+	if (Runtime && Runtime->bPersistentAbility)
+	{
+		Source = EGraspAbilityComponentSource::EventData;
+	}
+	
+	// Repeat queries are memoized by the GraspComponent until something that could change the result does
+	const FGraspCanActivateMemoKey MemoKey = { Spec->Handle, Spec->Level, Spec->InputID, GraspableComponent, SourceActor, Source };
+	bool bCanActivate = false;
+	if (GraspComponent->FindCanActivateMemo(MemoKey, bCanActivate))
+	{
+		return bCanActivate;
+	}
 	
 	// Check if we can activate the ability
 	const FGameplayAbilityActorInfo* ActorInfo = ASC->AbilityActorInfo.Get();
 	FGameplayTagContainer RelevantTags;
 	if (Spec->Ability->CanActivateAbility(Spec->Handle, ActorInfo, nullptr, nullptr, &RelevantTags))
 	{
+		// The same payload as activation, unless the GraspData says the ability won't inspect the target data
+		const bool bGatherTargetData = !Runtime || !Runtime->bCanActivateWithoutTargetData;
 		FGameplayEventData Payload;
-		if (PrepareGraspAbilityDataPayload(GraspableComponent, Payload, SourceActor, ActorInfo, Source))
-		{
-			return Spec->Ability->ShouldAbilityRespondToEvent(ActorInfo, &Payload);
-		}
-		return true;
+		bCanActivate = PrepareGraspAbilityDataPayload(GraspableComponent, Payload, SourceActor, ActorInfo, Source, bGatherTargetData) ?
+			Spec->Ability->ShouldAbilityRespondToEvent(ActorInfo, &Payload) : true;
 	}
-	return false;
+
+	GraspComponent->AddCanActivateMemo(MemoKey, bCanActivate);
+	return bCanActivate;
 }
 
 bool UGraspStatics::TryActivateGraspAbility(const AActor* SourceActor, UPrimitiveComponent* GraspableComponent,
@@ -239,6 +298,13 @@ bool UGraspStatics::TryActivateGraspAbility(const AActor* SourceActor, UPrimitiv
 	{
 		return false;
 	}
+
+	// Persistent abilities are shared between GraspData, the component must always be sent with the event data
+	const FGraspDataRuntime* Runtime = Graspable->GetGraspDataRuntime();
+	if (Runtime && Runtime->bPersistentAbility)
+	{
+		Source = EGraspAbilityComponentSource::EventData;
+	}
 	
 	// Optionally add the input tag to the ability spec
 	if (Graspable->GetGraspData()->InputTag.IsValid())
@@ -249,12 +315,9 @@ bool UGraspStatics::TryActivateGraspAbility(const AActor* SourceActor, UPrimitiv
 	// Notify
 	GraspComponent->PreTryActivateGraspAbility(SourceActor, GraspableComponent, Source, Spec);
 	
-	// Optional target data
+	// Prepare the payload, this is the only time the optional target data is gathered
 	FGameplayAbilityActorInfo* ActorInfo = ASC->AbilityActorInfo.Get();
-	const TArray<FGameplayAbilityTargetData*> OptionalTargetData = Graspable->GatherOptionalGraspTargetData(ActorInfo);
 	FGameplayEventData Payload;
-
-	// Prepare the payload
 	if (PrepareGraspAbilityDataPayload(GraspableComponent, Payload, SourceActor, ActorInfo, Source))
 	{
 		if (ASC->TriggerAbilityFromGameplayEvent(Spec->Handle, ActorInfo,
@@ -455,6 +518,40 @@ UGraspComponent* UGraspStatics::FindGraspComponentForPlayerState(APlayerState* P
 	return nullptr;
 }
 
+UGraspInteractorComponent* UGraspStatics::FindGraspInteractorForActor(const AActor* Actor)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::FindGraspInteractorForActor);
+
+	if (!IsValid(Actor))
+	{
+		return nullptr;
+	}
+
+	// Only Local and Authority has a Controller
+	if (Actor->GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		return nullptr;
+	}
+
+	// Maybe the actor is a controller
+	if (const AController* Controller = Cast<AController>(Actor))
+	{
+		return Controller->FindComponentByClass<UGraspInteractorComponent>();
+	}
+
+	// Maybe the actor is a pawn
+	if (const APawn* Pawn = Cast<APawn>(Actor))
+	{
+		if (const AController* Controller = Pawn->GetController())
+		{
+			return Controller->FindComponentByClass<UGraspInteractorComponent>();
+		}
+	}
+
+	// Unsupported actor
+	return nullptr;
+}
+
 bool UGraspStatics::AddGraspAbilityLock(const AActor* SourceActor, const UPrimitiveComponent* GraspableComponent)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspStatics::AddGraspAbilityLock);
@@ -0,0 +1,21 @@
+﻿// Copyright (c) Jared Taylor
+
+#include "GraspStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(GRASP_API, Grasp, true);
+LLM_DEFINE_TAG(Grasp);
+
+DEFINE_STAT(STAT_GraspScanRequests);
+DEFINE_STAT(STAT_GraspNativeScans);
+DEFINE_STAT(STAT_GraspTargetingHandlesCreated);
+DEFINE_STAT(STAT_GraspTargetingHandlesReused);
+DEFINE_STAT(STAT_GraspLineOfSightTraces);
+DEFINE_STAT(STAT_GraspLineOfSightCacheHits);
+DEFINE_STAT(STAT_GraspTargetsSkippedBeyondMaxRange);
+DEFINE_STAT(STAT_GraspCanActivateMemoHits);
+DEFINE_STAT(STAT_GraspCanActivateMemoMisses);
+DEFINE_STAT(STAT_GraspScanHangsRecovered);
+DEFINE_STAT(STAT_GraspPersistentTargetingHandles);
+DEFINE_STAT(STAT_GraspGrantLatencyP50);
+DEFINE_STAT(STAT_GraspGrantLatencyP95);
+DEFINE_STAT(STAT_GraspRequestGrasp);
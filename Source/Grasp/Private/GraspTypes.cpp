@@ -4,5 +4,6 @@
 #include "GraspTypes.h"
 
 DEFINE_LOG_CATEGORY(LogGrasp);
+DEFINE_LOG_CATEGORY(LogGraspScan);
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspTypes)
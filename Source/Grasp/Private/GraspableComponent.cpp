@@ -0,0 +1,39 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspableComponent.h"
+
+#include "GraspDataRuntime.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspableComponent)
+
+
+const FGraspDataRuntime* IGraspableComponent::GetGraspDataRuntime() const
+{
+	const UGraspData* Data = GetGraspData();
+	if (!Data)
+	{
+		return nullptr;
+	}
+
+	FGraspDataRuntimeTable& Table = FGraspDataRuntimeTable::Get();
+	if (!Table.IsValidEntry(GraspDataRuntimeIndex, Data))
+	{
+		GraspDataRuntimeIndex = Table.Register(Data);
+	}
+	return &Table.GetEntry(GraspDataRuntimeIndex);
+}
+
+bool IGraspableComponent::HasOptionalGraspTargetData(const FGameplayAbilityActorInfo* ActorInfo) const
+{
+	FGraspTargetDataArray TargetData;
+	GatherOptionalGraspTargetDataInto(ActorInfo, TargetData);
+
+	// Nothing took ownership of the target data
+	for (const FGameplayAbilityTargetData* Data : TargetData)
+	{
+		delete Data;
+	}
+	return TargetData.Num() > 0;
+}
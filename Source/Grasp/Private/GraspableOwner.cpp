@@ -0,0 +1,22 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspableOwner.h"
+
+#include "Abilities/GameplayAbilityTargetTypes.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GraspableOwner)
+
+
+bool IGraspableOwner::HasOptionalGraspTargetData(const FGameplayAbilityActorInfo* ActorInfo) const
+{
+	FGraspTargetDataArray TargetData;
+	GatherOptionalGraspTargetDataInto(ActorInfo, TargetData);
+
+	// Nothing took ownership of the target data
+	for (const FGameplayAbilityTargetData* Data : TargetData)
+	{
+		delete Data;
+	}
+	return TargetData.Num() > 0;
+}
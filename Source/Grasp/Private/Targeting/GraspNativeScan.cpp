@@ -0,0 +1,130 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Targeting/GraspNativeScan.h"
+
+#include "GraspStats.h"
+#include "GraspTypes.h"
+#include "Filtering/GraspFilterTask.h"
+#include "Targeting/GraspTargetSelection.h"
+#include "Targeting/GraspTargetingRequestData.h"
+#include "Targeting/GraspTargetingStatics.h"
+#include "TargetingSystem/TargetingPreset.h"
+#include "Types/TargetingSystemTypes.h"
+
+
+bool FGraspNativeScan::IsCompatible(const UTargetingPreset* Preset)
+{
+	const FTargetingTaskSet* TaskSet = Preset ? Preset->GetTargetingTaskSet() : nullptr;
+	if (!TaskSet || TaskSet->Tasks.Num() == 0 || !Cast<UGraspTargetSelection>(TaskSet->Tasks[0]))
+	{
+		return false;
+	}
+
+	for (int32 i = 1; i < TaskSet->Tasks.Num(); i++)
+	{
+		if (!Cast<UGraspFilterTask>(TaskSet->Tasks[i]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FGraspNativeScan::Execute(const UTargetingPreset* Preset, const FTargetingRequestHandle& TargetingHandle,
+	const FGameplayTag& ScanTag, TArray<FGraspScanResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspNativeScan::Execute);
+
+	if (!TargetingHandle.IsValid())
+	{
+		return;
+	}
+
+	const TArray<TObjectPtr<UTargetingTask>>& Tasks = Preset->GetTargetingTaskSet()->Tasks;
+
+	// Selection
+	CastChecked<UGraspTargetSelection>(Tasks[0])->ExecuteNative(TargetingHandle);
+
+	FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle);
+	if (!Results || Results->TargetResults.Num() == 0)
+	{
+		return;
+	}
+
+	bool bFiltersBeyondMaxRange = false;
+	TArray<const UGraspFilterTask*, TInlineAllocator<8>> Filters;
+	for (int32 i = 1; i < Tasks.Num(); i++)
+	{
+		Filters.Add(CastChecked<UGraspFilterTask>(Tasks[i]));
+		bFiltersBeyondMaxRange |= Filters.Last()->FiltersBeyondMaxRange();
+	}
+
+	CSV_SCOPED_TIMING_STAT(Grasp, Filters);
+
+	// Everything from the first target beyond the max range would be rejected, don't evaluate it
+	const FGraspFilterContext Context = FGraspFilterContext::Make(TargetingHandle);
+	int32 NumTargets = Results->TargetResults.Num();
+	if (bFiltersBeyondMaxRange && Context.SourceActor)
+	{
+		NumTargets = UGraspFilterTask::GetMaxRangeCutoff(Context, Results->TargetResults);
+		INC_DWORD_STAT_BY(STAT_GraspTargetsSkippedBeyondMaxRange, Results->TargetResults.Num() - NumTargets);
+#if ENABLE_VISUAL_LOG
+		if (NumTargets < Results->TargetResults.Num())
+		{
+			UGraspFilterTask::VisLogSkippedBeyondMaxRange(Context, Results->TargetResults.Num() - NumTargets);
+		}
+#endif
+	}
+
+	// Rejections per filter for the Gameplay Debugger
+	FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle);
+	const bool bCollectDebug = RequestData && RequestData->bCollectDebug;
+	TArray<int32, TInlineAllocator<8>> NumRejected;
+	if (bCollectDebug)
+	{
+		NumRejected.SetNumZeroed(Filters.Num());
+	}
+
+	// Filter each target through every filter, stopping at the first that rejects it
+	OutResults.Reserve(OutResults.Num() + NumTargets);
+	for (int32 TargetIndex = 0; TargetIndex < NumTargets; TargetIndex++)
+	{
+		FTargetingDefaultResultData& ResultData = Results->TargetResults[TargetIndex];
+		const UPrimitiveComponent* TargetComponent = ResultData.HitResult.GetComponent();
+
+		bool bFiltered = false;
+		for (int32 FilterIndex = 0; FilterIndex < Filters.Num(); FilterIndex++)
+		{
+			if (Filters[FilterIndex]->ShouldFilterGraspTarget(Context, TargetComponent))
+			{
+				if (bCollectDebug)
+				{
+					NumRejected[FilterIndex]++;
+				}
+#if ENABLE_VISUAL_LOG
+				Filters[FilterIndex]->VisLogRejected(Context, TargetComponent);
+#endif
+				bFiltered = true;
+				break;
+			}
+		}
+
+		if (!bFiltered)
+		{
+			UGraspTargetingStatics::AddGraspScanResult(ResultData.HitResult, ScanTag, OutResults);
+		}
+	}
+
+	// Targets beyond the max range were rejected before any filter evaluated them
+	if (bCollectDebug)
+	{
+		int32 NumRemaining = Results->TargetResults.Num();
+		for (int32 FilterIndex = 0; FilterIndex < Filters.Num(); FilterIndex++)
+		{
+			const int32 NumBefore = NumRemaining;
+			NumRemaining -= NumRejected[FilterIndex] + (FilterIndex == 0 ? Results->TargetResults.Num() - NumTargets : 0);
+			RequestData->FilterCounts.Add({ Filters[FilterIndex]->GetFName(), NumBefore, NumRemaining });
+		}
+	}
+}
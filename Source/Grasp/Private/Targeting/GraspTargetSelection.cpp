@@ -4,6 +4,7 @@
 #include "Targeting/GraspTargetSelection.h"
 
 #include "GraspDeveloper.h"
+#include "GraspStats.h"
 #include "Components/CapsuleComponent.h"
 #include "TargetingSystem/TargetingSubsystem.h"
 #include "Engine/OverlapResult.h"
@@ -13,6 +14,8 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "System/GraspVersioning.h"
 #include "Targeting/GraspTargetingStatics.h"
+#include "Targeting/GraspTargetingRequestData.h"
+#include "VisualLogger/VisualLogger.h"
 
 #if UE_ENABLE_DEBUG_DRAWING
 #if WITH_EDITORONLY_DATA
@@ -51,6 +54,7 @@ UGraspTargetSelection::UGraspTargetSelection(const FObjectInitializer& ObjectIni
 	bIgnoreInstigatorActor = false;
 	bTraceMultipleComponentsPerActor = true;  // Required for multiple interact components on the same actor
 	bTraceComplex = false;
+	bSortByDistance = true;
 
 	LocationSource = EGraspTargetLocationSource::Actor;
 	RotationSource = EGraspTargetRotationSource::Actor;
@@ -73,6 +77,12 @@ UGraspTargetSelection::UGraspTargetSelection(const FObjectInitializer& ObjectIni
 	HalfHeightScalar = 1.f;
 	MaxHalfHeightScalar = 1.f;
 
+	ViewLength = 300.f;
+	ConeHalfAngle = 20.f;
+	FrustumHalfFOV = 30.f;
+	FrustumHalfVerticalFOV = 20.f;
+	FrustumNearDistance = 0.f;
+
 	GraspAbilityRadius = 0.f;
 	UpdateGraspAbilityRadius();
 }
@@ -124,6 +134,10 @@ void UGraspTargetSelection::UpdateGraspAbilityRadius()
 	case EGraspTargetingShape::CharacterCapsule:
 		GraspAbilityRadius = 0.5f * ((GetMaxRadius() * GetMaxRadiusScalar()) + (GetMaxHalfHeight() * GetMaxHalfHeightScalar()));
 		break;
+	case EGraspTargetingShape::Cone:
+	case EGraspTargetingShape::Frustum:
+		GraspAbilityRadius = ViewLength;  // Measured from the source, not the shape center
+		break;
 	}
 }
 
@@ -143,6 +157,7 @@ void UGraspTargetSelection::PostEditChangeProperty(struct FPropertyChangedEvent&
 		GET_MEMBER_NAME_CHECKED(ThisClass, HalfExtent),
 		GET_MEMBER_NAME_CHECKED(ThisClass, Radius),
 		GET_MEMBER_NAME_CHECKED(ThisClass, HalfHeight),
+		GET_MEMBER_NAME_CHECKED(ThisClass, ViewLength),
 		GET_MEMBER_NAME_CHECKED(ThisClass, ShapeType)
 	};
 
@@ -260,6 +275,23 @@ void UGraspTargetSelection::Execute(const FTargetingRequestHandle& TargetingHand
 
 	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Executing);
 
+	MakeSelectionContext(TargetingHandle);
+
+	// Scan LOD fine tier re-evaluates the candidates from the last coarse scan, there is no broadphase
+	if (const FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle))
+	{
+		if (RequestData->Tier == EGraspScanTier::Fine)
+		{
+#if UE_ENABLE_DEBUG_DRAWING
+			ResetDebugString(TargetingHandle);
+#endif
+			ProcessCandidates(TargetingHandle, RequestData->GetFineCandidates());
+			ReleaseSelectionContext(TargetingHandle);
+			SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
+			return;
+		}
+	}
+
 	// @note: There isn't Async Overlap support based on Primitive Component, so even if using async targeting, it will
 	// run this task in "immediate" mode.
 	if (IsAsyncTargetingRequest(TargetingHandle))
@@ -283,33 +315,8 @@ void UGraspTargetSelection::ExecuteImmediateTrace(const FTargetingRequestHandle&
 	const UWorld* World = GetSourceContextWorld(TargetingHandle);
 	if (World && TargetingHandle.IsValid())
 	{
-		const FVector SourceLocation = GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
-		const FQuat SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
-
 		TArray<FOverlapResult> OverlapResults;
-		const FCollisionShape CollisionShape = GetCollisionShape(TargetingHandle);
-		FCollisionQueryParams OverlapParams(TEXT("UGraspTargetSelection_AOE"), SCENE_QUERY_STAT_ONLY(UGraspTargetSelection_AOE), false);
-		InitCollisionParams(TargetingHandle, OverlapParams);
-
-		if (CollisionObjectTypes.Num() > 0)
-		{
-			FCollisionObjectQueryParams ObjectParams;
-			for (auto Iter = CollisionObjectTypes.CreateConstIterator(); Iter; ++Iter)
-			{
-				const ECollisionChannel& Channel = UCollisionProfile::Get()->ConvertToCollisionChannel(false, *Iter);
-				ObjectParams.AddObjectTypesToQuery(Channel);
-			}
-
-			World->OverlapMultiByObjectType(OverlapResults, SourceLocation, SourceRotation, ObjectParams, CollisionShape, OverlapParams);
-		}
-		else if (CollisionProfileName.Name != TEXT("NoCollision"))
-		{
-			World->OverlapMultiByProfile(OverlapResults, SourceLocation, SourceRotation, CollisionProfileName.Name, CollisionShape, OverlapParams);
-		}
-		else
-		{
-			World->OverlapMultiByChannel(OverlapResults, SourceLocation, SourceRotation, CollisionChannel, CollisionShape, OverlapParams);
-		}
+		OverlapImmediate(TargetingHandle, World, OverlapResults);
 
 		const int32 NumValidResults = ProcessOverlapResults(TargetingHandle, OverlapResults);
 		
@@ -322,9 +329,74 @@ void UGraspTargetSelection::ExecuteImmediateTrace(const FTargetingRequestHandle&
 #endif
 	}
 
+	ReleaseSelectionContext(TargetingHandle);
 	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
 }
 
+void UGraspTargetSelection::ExecuteNative(const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::ExecuteNative);
+
+#if UE_ENABLE_DEBUG_DRAWING
+	ResetDebugString(TargetingHandle);
+#endif
+
+	MakeSelectionContext(TargetingHandle);
+
+	// Scan LOD fine tier re-evaluates the candidates from the last coarse scan, there is no broadphase
+	const FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle);
+	if (RequestData && RequestData->Tier == EGraspScanTier::Fine)
+	{
+		ProcessCandidates(TargetingHandle, RequestData->GetFineCandidates());
+	}
+	else
+	{
+		const UWorld* World = GetSourceContextWorld(TargetingHandle);
+		if (World && TargetingHandle.IsValid())
+		{
+			TArray<FOverlapResult> OverlapResults;
+			OverlapImmediate(TargetingHandle, World, OverlapResults);
+			ProcessOverlapResults(TargetingHandle, OverlapResults);
+		}
+	}
+
+	ReleaseSelectionContext(TargetingHandle);
+}
+
+void UGraspTargetSelection::OverlapImmediate(const FTargetingRequestHandle& TargetingHandle, const UWorld* World,
+	TArray<FOverlapResult>& OutOverlapResults) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::OverlapImmediate);
+
+	const FGraspSelectionContext& Context = GetSelectionContext(TargetingHandle);
+	const FVector& SourceLocation = Context.ShapeLocation;
+	const FQuat& SourceRotation = Context.SourceRotation;
+	const FCollisionShape& CollisionShape = Context.CollisionShape;
+
+	FCollisionQueryParams OverlapParams(TEXT("UGraspTargetSelection_AOE"), SCENE_QUERY_STAT_ONLY(UGraspTargetSelection_AOE), false);
+	InitCollisionParams(TargetingHandle, OverlapParams);
+
+	if (CollisionObjectTypes.Num() > 0)
+	{
+		FCollisionObjectQueryParams ObjectParams;
+		for (auto Iter = CollisionObjectTypes.CreateConstIterator(); Iter; ++Iter)
+		{
+			const ECollisionChannel& Channel = UCollisionProfile::Get()->ConvertToCollisionChannel(false, *Iter);
+			ObjectParams.AddObjectTypesToQuery(Channel);
+		}
+
+		World->OverlapMultiByObjectType(OutOverlapResults, SourceLocation, SourceRotation, ObjectParams, CollisionShape, OverlapParams);
+	}
+	else if (CollisionProfileName.Name != TEXT("NoCollision"))
+	{
+		World->OverlapMultiByProfile(OutOverlapResults, SourceLocation, SourceRotation, CollisionProfileName.Name, CollisionShape, OverlapParams);
+	}
+	else
+	{
+		World->OverlapMultiByChannel(OutOverlapResults, SourceLocation, SourceRotation, CollisionChannel, CollisionShape, OverlapParams);
+	}
+}
+
 void UGraspTargetSelection::ExecuteAsyncTrace(const FTargetingRequestHandle& TargetingHandle) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::ExecuteAsyncTrace);
@@ -332,10 +404,11 @@ void UGraspTargetSelection::ExecuteAsyncTrace(const FTargetingRequestHandle& Tar
 	UWorld* World = GetSourceContextWorld(TargetingHandle);
 	if (World && TargetingHandle.IsValid())
 	{
-		const FVector SourceLocation = GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
-		const FQuat SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
+		const FGraspSelectionContext& Context = GetSelectionContext(TargetingHandle);
+		const FVector& SourceLocation = Context.ShapeLocation;
+		const FQuat& SourceRotation = Context.SourceRotation;
+		const FCollisionShape& CollisionShape = Context.CollisionShape;
 
-		const FCollisionShape CollisionShape = GetCollisionShape(TargetingHandle);
 		FCollisionQueryParams OverlapParams(TEXT("UGraspTargetSelection_AOE"), SCENE_QUERY_STAT_ONLY(UGraspTargetSelection_AOE_Shape), false);
 		InitCollisionParams(TargetingHandle, OverlapParams);
 
@@ -362,6 +435,7 @@ void UGraspTargetSelection::ExecuteAsyncTrace(const FTargetingRequestHandle& Tar
 	}
 	else
 	{
+		ReleaseSelectionContext(TargetingHandle);
 		SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
 	}
 }
@@ -388,6 +462,7 @@ void UGraspTargetSelection::HandleAsyncOverlapComplete(const FTraceHandle& InTra
 #endif
 	}
 
+	ReleaseSelectionContext(TargetingHandle);
 	SetTaskAsyncState(TargetingHandle, ETargetingTaskAsyncState::Completed);
 }
 
@@ -402,13 +477,24 @@ int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle
 	MutableThis->UpdateGraspAbilityRadius();
 #endif
 	
+	// Scan LOD coarse tier gathers the candidate set for the fine tier
+	FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle);
+	TArray<TWeakObjectPtr<UPrimitiveComponent>>* Candidates = RequestData && RequestData->Tier == EGraspScanTier::Coarse ?
+		&RequestData->Candidates : nullptr;
+	
 	// process the overlaps
 	int32 NumValidResults = 0;
 	if (Overlaps.Num() > 0)
 	{
 		FTargetingDefaultResultsSet& TargetingResults = FTargetingDefaultResultsSet::FindOrAdd(TargetingHandle);
-		const FVector SourceLocation = GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
-		const FQuat SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
+		if (Candidates)
+		{
+			Candidates->Reset(Overlaps.Num());
+		}
+
+		const FGraspSelectionContext& Context = GetSelectionContext(TargetingHandle);
+		const FVector& SourceLocation = Context.SourceLocation;
+		const FQuat& SourceRotation = Context.SourceRotation;
 
 		for (const FOverlapResult& OverlapResult : Overlaps)
 		{
@@ -417,15 +503,12 @@ int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle
 				continue;
 			}
 
-			// cylinders use box overlaps, so a radius check is necessary to constrain it to the bounds of a cylinder
-			if (ShapeType == EGraspTargetingShape::Cylinder)
+			// cylinders, cones, and frustums use box overlaps, so an exact test is necessary to constrain it to the shape
+			const UPrimitiveComponent* OverlapComponent = OverlapResult.GetComponent();
+			if (!IsWithinShape(SourceLocation, SourceRotation, ShapeType == EGraspTargetingShape::Cylinder || !OverlapComponent ?
+				OverlapResult.GetActor()->GetActorLocation() : OverlapComponent->GetComponentLocation()))
 			{
-				const float RadiusSquared = (HalfExtent.X * HalfExtent.X);
-				const float DistanceSquared = FVector::DistSquared2D(OverlapResult.GetActor()->GetActorLocation(), SourceLocation);
-				if (DistanceSquared > RadiusSquared)
-				{
-					continue;
-				}
+				continue;
 			}
 
 			bool bAddResult = true;
@@ -459,18 +542,162 @@ int32 UGraspTargetSelection::ProcessOverlapResults(const FTargetingRequestHandle
 
 				// We need the normalized distance, which we calculate from GraspAbilityRadius
 				ResultData->HitResult.Distance = GraspAbilityRadius;
+
+				if (Candidates)
+				{
+					Candidates->Add(OverlapResult.GetComponent());
+				}
 			}
 		}
 
+		SortResultsByDistance(TargetingHandle, TargetingResults.TargetResults);
+
 #if UE_ENABLE_DEBUG_DRAWING
 		BuildDebugString(TargetingHandle, TargetingResults.TargetResults);
 #endif
 	}
 
+	CSV_CUSTOM_STAT(Grasp, Candidates, NumValidResults, ECsvCustomStatOp::Accumulate);
+
+#if ENABLE_VISUAL_LOG
+	VisLogSelection(TargetingHandle, NumValidResults);
+#endif
+
 	return NumValidResults;
 }
 
+int32 UGraspTargetSelection::ProcessCandidates(const FTargetingRequestHandle& TargetingHandle,
+	const TArray<TWeakObjectPtr<UPrimitiveComponent>>& Candidates) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::ProcessCandidates);
+
+#if WITH_EDITOR
+	// During editor update this so we can modify properties during runtime
+	UGraspTargetSelection* MutableThis = const_cast<UGraspTargetSelection*>(this);
+	MutableThis->UpdateGraspAbilityRadius();
+#endif
+
+	int32 NumValidResults = 0;
+	if (Candidates.Num() > 0)
+	{
+		FTargetingDefaultResultsSet& TargetingResults = FTargetingDefaultResultsSet::FindOrAdd(TargetingHandle);
+		const FGraspSelectionContext& Context = GetSelectionContext(TargetingHandle);
+		const FVector& SourceLocation = Context.SourceLocation;
+		const FQuat& SourceRotation = Context.SourceRotation;
+
+		for (const TWeakObjectPtr<UPrimitiveComponent>& WeakCandidate : Candidates)
+		{
+			// Destroyed since the coarse scan
+			UPrimitiveComponent* Candidate = WeakCandidate.Get();
+			AActor* CandidateActor = Candidate ? Candidate->GetOwner() : nullptr;
+			if (!CandidateActor)
+			{
+				continue;
+			}
+
+			// The source may have moved or turned since the coarse scan, matches the test in ProcessOverlapResults()
+			if (!IsWithinShape(SourceLocation, SourceRotation, ShapeType == EGraspTargetingShape::Cylinder ?
+				CandidateActor->GetActorLocation() : Candidate->GetComponentLocation()))
+			{
+				continue;
+			}
+
+			NumValidResults++;
+
+			// Matches ProcessOverlapResults() so the filters can't tell the difference
+			FTargetingDefaultResultData* ResultData = new(TargetingResults.TargetResults) FTargetingDefaultResultData();
+			ResultData->HitResult.HitObjectHandle = FActorInstanceHandle(CandidateActor);
+			ResultData->HitResult.Component = Candidate;
+			ResultData->HitResult.ImpactPoint = CandidateActor->GetActorLocation();
+			ResultData->HitResult.Location = CandidateActor->GetActorLocation();
+			ResultData->HitResult.TraceStart = SourceLocation;
+			ResultData->HitResult.Normal = SourceRotation.Vector();
+			ResultData->HitResult.Distance = GraspAbilityRadius;
+		}
+
+		SortResultsByDistance(TargetingHandle, TargetingResults.TargetResults);
+
+#if UE_ENABLE_DEBUG_DRAWING
+		BuildDebugString(TargetingHandle, TargetingResults.TargetResults);
+#endif
+	}
+
+	CSV_CUSTOM_STAT(Grasp, Candidates, NumValidResults, ECsvCustomStatOp::Accumulate);
+
+#if ENABLE_VISUAL_LOG
+	VisLogSelection(TargetingHandle, NumValidResults);
+#endif
+
+	return NumValidResults;
+}
+
+void UGraspTargetSelection::SortResultsByDistance(const FTargetingRequestHandle& TargetingHandle,
+	TArray<FTargetingDefaultResultData>& TargetResults) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::SortResultsByDistance);
+
+	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
+	if (!bSortByDistance || !SourceContext || !SourceContext->SourceActor)
+	{
+		return;
+	}
+
+	// Matches FGraspDataRuntime::QueryRange() so the range filters can use it
+	const FVector SourceLocation = SourceContext->SourceActor->GetActorLocation();
+	for (FTargetingDefaultResultData& ResultData : TargetResults)
+	{
+		const UPrimitiveComponent* Component = ResultData.HitResult.GetComponent();
+		ResultData.Score = Component ? FVector::DistSquared2D(Component->GetComponentLocation(), SourceLocation) : UE_MAX_FLT;
+	}
+
+	TargetResults.Sort([](const FTargetingDefaultResultData& A, const FTargetingDefaultResultData& B)
+	{
+		return A.Score < B.Score;
+	});
+
+	// Requests made outside of UGraspComponent have no data, and are never cut off
+	if (FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle))
+	{
+		RequestData->bSortedByDistance = true;
+	}
+}
+
+const FGraspSelectionContext& UGraspTargetSelection::MakeSelectionContext(
+	const FTargetingRequestHandle& TargetingHandle) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::MakeSelectionContext);
+
+	FGraspSelectionContext& Context = FGraspSelectionContext::FindOrAdd(TargetingHandle);
+	Context.SourceLocation = GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
+	Context.SourceRotation = (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
+	Context.ShapeLocation = GetCollisionShapeLocation(Context.SourceLocation, Context.SourceRotation);
+	Context.MovementAlpha = CalcPawnMovementAlpha(TargetingHandle);
+	Context.CollisionShape = GetCollisionShape(TargetingHandle, Context.MovementAlpha);
+	return Context;
+}
+
+const FGraspSelectionContext& UGraspTargetSelection::GetSelectionContext(
+	const FTargetingRequestHandle& TargetingHandle) const
+{
+	if (const FGraspSelectionContext* Context = FGraspSelectionContext::Find(TargetingHandle))
+	{
+		return *Context;
+	}
+	return MakeSelectionContext(TargetingHandle);
+}
+
+void UGraspTargetSelection::ReleaseSelectionContext(const FTargetingRequestHandle& TargetingHandle)
+{
+	FGraspSelectionContext::Remove(TargetingHandle);
+}
+
 FCollisionShape UGraspTargetSelection::GetCollisionShape(const FTargetingRequestHandle& TargetingHandle) const
+{
+	return GetCollisionShape(TargetingHandle, CalcPawnMovementAlpha(TargetingHandle));
+}
+
+FCollisionShape UGraspTargetSelection::GetCollisionShape(const FTargetingRequestHandle& TargetingHandle,
+	float MovementAlpha) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetSelection::GetCollisionShape);
 	
@@ -478,23 +705,23 @@ FCollisionShape UGraspTargetSelection::GetCollisionShape(const FTargetingRequest
 	{
 	case EGraspTargetingShape::Box:
 		{
-			const FVector E = FMath::Lerp<FVector>(HalfExtent, MaxHalfExtent, CalcPawnMovementAlpha(TargetingHandle));
+			const FVector E = FMath::Lerp<FVector>(HalfExtent, MaxHalfExtent, MovementAlpha);
 			return FCollisionShape::MakeBox(E);
 		}
 	case EGraspTargetingShape::Cylinder:
 		{
-			const FVector E = FMath::Lerp<FVector>(HalfExtent, MaxHalfExtent, CalcPawnMovementAlpha(TargetingHandle));
+			const FVector E = FMath::Lerp<FVector>(HalfExtent, MaxHalfExtent, MovementAlpha);
 			return FCollisionShape::MakeBox(E);
 		}
 	case EGraspTargetingShape::Sphere:
 		{
-			const float R = FMath::Lerp<float>(Radius.GetValue(), MaxRadius.GetValue(), CalcPawnMovementAlpha(TargetingHandle));
+			const float R = FMath::Lerp<float>(Radius.GetValue(), MaxRadius.GetValue(), MovementAlpha);
 			return FCollisionShape::MakeSphere(R);
 		}
 	case EGraspTargetingShape::Capsule:
 		{
-			const float R = FMath::Lerp<float>(Radius.GetValue(), MaxRadius.GetValue(), CalcPawnMovementAlpha(TargetingHandle));
-			const float H = FMath::Lerp<float>(HalfHeight.GetValue(), MaxHalfHeight.GetValue(), CalcPawnMovementAlpha(TargetingHandle));
+			const float R = FMath::Lerp<float>(Radius.GetValue(), MaxRadius.GetValue(), MovementAlpha);
+			const float H = FMath::Lerp<float>(HalfHeight.GetValue(), MaxHalfHeight.GetValue(), MovementAlpha);
 			return FCollisionShape::MakeCapsule(R, H);
 		}
 	case EGraspTargetingShape::CharacterCapsule:
@@ -503,21 +730,79 @@ FCollisionShape UGraspTargetSelection::GetCollisionShape(const FTargetingRequest
 			float CapsuleHalfHeight = 0.f;
 			if (GetPawnCapsuleSize(TargetingHandle, CapsuleRadius, CapsuleHalfHeight))
 			{
-				const float R = FMath::Lerp<float>(RadiusScalar.GetValue(), MaxRadiusScalar.GetValue(), CalcPawnMovementAlpha(TargetingHandle));
-				const float H = FMath::Lerp<float>(HalfHeightScalar.GetValue(), MaxHalfHeightScalar.GetValue(), CalcPawnMovementAlpha(TargetingHandle));
+				const float R = FMath::Lerp<float>(RadiusScalar.GetValue(), MaxRadiusScalar.GetValue(), MovementAlpha);
+				const float H = FMath::Lerp<float>(HalfHeightScalar.GetValue(), MaxHalfHeightScalar.GetValue(), MovementAlpha);
 				return FCollisionShape::MakeCapsule(CapsuleRadius * R, CapsuleHalfHeight * H);
 			}
 			else
 			{
-				const float R = FMath::Lerp<float>(Radius.GetValue(), MaxRadius.GetValue(), CalcPawnMovementAlpha(TargetingHandle));
-				const float H = FMath::Lerp<float>(HalfHeight.GetValue(), MaxHalfHeight.GetValue(), CalcPawnMovementAlpha(TargetingHandle));
+				const float R = FMath::Lerp<float>(Radius.GetValue(), MaxRadius.GetValue(), MovementAlpha);
+				const float H = FMath::Lerp<float>(HalfHeight.GetValue(), MaxHalfHeight.GetValue(), MovementAlpha);
 				return FCollisionShape::MakeCapsule(R, H);
 			}
 		}
+	case EGraspTargetingShape::Cone:
+		{
+			const float ConeRadius = ViewLength * FMath::Tan(FMath::DegreesToRadians(ConeHalfAngle));
+			return FCollisionShape::MakeBox(FVector(0.5f * ViewLength, ConeRadius, ConeRadius));
+		}
+	case EGraspTargetingShape::Frustum:
+		{
+			const float Near = FMath::Min(FrustumNearDistance, ViewLength);
+			const float Width = ViewLength * FMath::Tan(FMath::DegreesToRadians(FrustumHalfFOV));
+			const float Height = ViewLength * FMath::Tan(FMath::DegreesToRadians(FrustumHalfVerticalFOV));
+			return FCollisionShape::MakeBox(FVector(0.5f * (ViewLength - Near), Width, Height));
+		}
 	default: return {};
 	}
 }
 
+FVector UGraspTargetSelection::GetCollisionShapeLocation(const FVector& SourceLocation, const FQuat& SourceRotation) const
+{
+	switch (ShapeType)
+	{
+	case EGraspTargetingShape::Cone:
+		return SourceLocation + SourceRotation.GetForwardVector() * (0.5f * ViewLength);
+	case EGraspTargetingShape::Frustum:
+		return SourceLocation + SourceRotation.GetForwardVector() * (0.5f * (ViewLength + FMath::Min(FrustumNearDistance, ViewLength)));
+	default:
+		return SourceLocation;
+	}
+}
+
+bool UGraspTargetSelection::IsWithinShape(const FVector& SourceLocation, const FQuat& SourceRotation,
+	const FVector& Location) const
+{
+	switch (ShapeType)
+	{
+	case EGraspTargetingShape::Cylinder:
+		return FVector::DistSquared2D(Location, SourceLocation) <= HalfExtent.X * HalfExtent.X;
+	case EGraspTargetingShape::Cone:
+		{
+			// Within the length, and Acos(Dot) <= HalfAngle without normalizing
+			const FVector Delta = Location - SourceLocation;
+			const float Along = Delta | SourceRotation.GetForwardVector();
+			if (Along < 0.f || Along > ViewLength)
+			{
+				return false;
+			}
+			return Along >= Delta.Size() * FMath::Cos(FMath::DegreesToRadians(ConeHalfAngle));
+		}
+	case EGraspTargetingShape::Frustum:
+		{
+			const FVector Local = SourceRotation.UnrotateVector(Location - SourceLocation);
+			if (Local.X < FrustumNearDistance || Local.X > ViewLength)
+			{
+				return false;
+			}
+			return FMath::Abs(Local.Y) <= Local.X * FMath::Tan(FMath::DegreesToRadians(FrustumHalfFOV)) &&
+				FMath::Abs(Local.Z) <= Local.X * FMath::Tan(FMath::DegreesToRadians(FrustumHalfVerticalFOV));
+		}
+	default:
+		return true;
+	}
+}
+
 void UGraspTargetSelection::InitCollisionParams(const FTargetingRequestHandle& TargetingHandle,
 	FCollisionQueryParams& OutParams) const
 {
@@ -530,9 +815,10 @@ void UGraspTargetSelection::DebugDrawBoundingVolume(const FTargetingRequestHandl
 {
 #if UE_ENABLE_DEBUG_DRAWING
 	const UWorld* World = GetSourceContextWorld(TargetingHandle);
-	const FVector SourceLocation = OverlapDatum ? OverlapDatum->Pos : GetSourceLocation(TargetingHandle) + GetSourceOffset(TargetingHandle);
-	const FQuat SourceRotation = OverlapDatum ? OverlapDatum->Rot : (GetSourceRotation(TargetingHandle) * GetSourceRotationOffset(TargetingHandle)).GetNormalized();
-	const FCollisionShape CollisionShape = GetCollisionShape(TargetingHandle);
+	const FGraspSelectionContext& Context = GetSelectionContext(TargetingHandle);
+	const FQuat SourceRotation = OverlapDatum ? OverlapDatum->Rot : Context.SourceRotation;
+	const FVector SourceLocation = OverlapDatum ? OverlapDatum->Pos : Context.ShapeLocation;
+	const FCollisionShape& CollisionShape = Context.CollisionShape;
 
 	constexpr bool bPersistentLines = false;
 #if UE_5_04_OR_LATER
@@ -565,10 +851,97 @@ void UGraspTargetSelection::DebugDrawBoundingVolume(const FTargetingRequestHandl
 				Color, bPersistentLines, LifeTime, DepthPriority, Thickness);
 			break;
 		}
+	case EGraspTargetingShape::Cone:
+		{
+			// SourceLocation is the center of the bounds, the cone starts at the source
+			const FVector Forward = SourceRotation.GetForwardVector();
+			const FVector Apex = SourceLocation - Forward * (0.5f * ViewLength);
+			const float Angle = FMath::DegreesToRadians(ConeHalfAngle);
+			DrawDebugCone(World, Apex, Forward, ViewLength, Angle, Angle, 16,
+				Color, bPersistentLines, LifeTime, DepthPriority, Thickness);
+			break;
+		}
+	case EGraspTargetingShape::Frustum:
+		{
+			const float Near = FMath::Min(FrustumNearDistance, ViewLength);
+			const FVector Apex = SourceLocation - SourceRotation.GetForwardVector() * (0.5f * (ViewLength + Near));
+			const float TanH = FMath::Tan(FMath::DegreesToRadians(FrustumHalfFOV));
+			const float TanV = FMath::Tan(FMath::DegreesToRadians(FrustumHalfVerticalFOV));
+
+			// Near and far plane corners, wound so consecutive corners share an edge
+			FVector Corners[2][4];
+			const float Distances[2] = { Near, ViewLength };
+			for (int32 i = 0; i < 2; i++)
+			{
+				const float D = Distances[i];
+				Corners[i][0] = Apex + SourceRotation.RotateVector(FVector(D, -D * TanH, -D * TanV));
+				Corners[i][1] = Apex + SourceRotation.RotateVector(FVector(D, D * TanH, -D * TanV));
+				Corners[i][2] = Apex + SourceRotation.RotateVector(FVector(D, D * TanH, D * TanV));
+				Corners[i][3] = Apex + SourceRotation.RotateVector(FVector(D, -D * TanH, D * TanV));
+			}
+
+			for (int32 i = 0; i < 4; i++)
+			{
+				const int32 Next = (i + 1) % 4;
+				DrawDebugLine(World, Corners[0][i], Corners[0][Next], Color, bPersistentLines, LifeTime, DepthPriority, Thickness);
+				DrawDebugLine(World, Corners[1][i], Corners[1][Next], Color, bPersistentLines, LifeTime, DepthPriority, Thickness);
+				DrawDebugLine(World, Corners[0][i], Corners[1][i], Color, bPersistentLines, LifeTime, DepthPriority, Thickness);
+			}
+			break;
+		}
 	}
 #endif
 }
 
+#if ENABLE_VISUAL_LOG
+void UGraspTargetSelection::VisLogSelection(const FTargetingRequestHandle& TargetingHandle, int32 NumValidResults) const
+{
+	const FTargetingSourceContext* SourceContext = FTargetingSourceContext::Find(TargetingHandle);
+	const AActor* LogOwner = SourceContext ? SourceContext->SourceActor : nullptr;
+	if (!LogOwner || !FVisualLogger::IsRecording())
+	{
+		return;
+	}
+
+	const FGraspTargetingRequestData* RequestData = FGraspTargetingRequestData::Find(TargetingHandle);
+	const EGraspScanTier Tier = RequestData ? RequestData->Tier : EGraspScanTier::Full;
+	const TCHAR* TierName = Tier == EGraspScanTier::Coarse ? TEXT("Coarse") : Tier == EGraspScanTier::Fine ? TEXT("Fine") : TEXT("Full");
+
+	const FGraspSelectionContext& Context = GetSelectionContext(TargetingHandle);
+	const FCollisionShape& CollisionShape = Context.CollisionShape;
+	const FColor Color = NumValidResults > 0 ? FColor::Green : FColor::Silver;
+	const FString Label = FString::Printf(TEXT("%s (%s): %d candidates"), *GetName(), TierName, NumValidResults);
+
+	switch (ShapeType)
+	{
+	case EGraspTargetingShape::Sphere:
+		UE_VLOG_LOCATION(LogOwner, LogGraspScan, Log, Context.ShapeLocation, CollisionShape.GetSphereRadius(), Color, TEXT("%s"), *Label);
+		break;
+	case EGraspTargetingShape::Capsule:
+	case EGraspTargetingShape::CharacterCapsule:
+		{
+			// Capsules are logged from the center of their base
+			const FVector Base = Context.ShapeLocation - Context.SourceRotation.GetUpVector() * CollisionShape.GetCapsuleHalfHeight();
+			UE_VLOG_CAPSULE(LogOwner, LogGraspScan, Log, Base, CollisionShape.GetCapsuleHalfHeight(), CollisionShape.GetCapsuleRadius(),
+				Context.SourceRotation, Color, TEXT("%s"), *Label);
+			break;
+		}
+	case EGraspTargetingShape::Cone:
+		UE_VLOG_CONE(LogOwner, LogGraspScan, Log, Context.SourceLocation, Context.SourceRotation.GetForwardVector(), ViewLength,
+			ConeHalfAngle, Color, TEXT("%s"), *Label);
+		break;
+	default:
+		{
+			// Box, and the bounds of Cylinder and Frustum
+			const FVector Extent = CollisionShape.GetExtent();
+			UE_VLOG_OBOX(LogOwner, LogGraspScan, Log, FBox(-Extent, Extent),
+				FQuatRotationTranslationMatrix(Context.SourceRotation, Context.ShapeLocation), Color, TEXT("%s"), *Label);
+			break;
+		}
+	}
+}
+#endif
+
 #if UE_ENABLE_DEBUG_DRAWING
 void UGraspTargetSelection::DrawDebug(UTargetingSubsystem* TargetingSubsystem, FTargetingDebugInfo& Info,
 	const FTargetingRequestHandle& TargetingHandle, float XOffset, float YOffset, int32 MinTextRowsToAdvance) const
@@ -0,0 +1,75 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "Targeting/GraspTargetingRequestData.h"
+
+#include "GraspStats.h"
+#include "Components/PrimitiveComponent.h"
+
+
+TMap<FTargetingRequestHandle, FGraspTargetingRequestData>& FGraspTargetingRequestData::GetStore()
+{
+	static TMap<FTargetingRequestHandle, FGraspTargetingRequestData> Store;
+	return Store;
+}
+
+FGraspTargetingRequestData* FGraspTargetingRequestData::Find(const FTargetingRequestHandle& Handle)
+{
+	check(IsInGameThread());
+	return GetStore().Find(Handle);
+}
+
+FGraspTargetingRequestData& FGraspTargetingRequestData::FindOrAdd(const FTargetingRequestHandle& Handle)
+{
+	check(IsInGameThread());
+	LLM_SCOPE_BYTAG(Grasp);
+	return GetStore().FindOrAdd(Handle);
+}
+
+void FGraspTargetingRequestData::Remove(const FTargetingRequestHandle& Handle)
+{
+	check(IsInGameThread());
+	GetStore().Remove(Handle);
+}
+
+SIZE_T FGraspTargetingRequestData::GetStoreAllocatedSize()
+{
+	check(IsInGameThread());
+	SIZE_T Size = GetStore().GetAllocatedSize();
+	for (const TPair<FTargetingRequestHandle, FGraspTargetingRequestData>& Entry : GetStore())
+	{
+		Size += Entry.Value.Candidates.GetAllocatedSize() + Entry.Value.FilterCounts.GetAllocatedSize();
+	}
+	return Size;
+}
+
+TMap<FTargetingRequestHandle, FGraspSelectionContext>& FGraspSelectionContext::GetStore()
+{
+	static TMap<FTargetingRequestHandle, FGraspSelectionContext> Store;
+	return Store;
+}
+
+FGraspSelectionContext* FGraspSelectionContext::Find(const FTargetingRequestHandle& Handle)
+{
+	check(IsInGameThread());
+	return GetStore().Find(Handle);
+}
+
+FGraspSelectionContext& FGraspSelectionContext::FindOrAdd(const FTargetingRequestHandle& Handle)
+{
+	check(IsInGameThread());
+	LLM_SCOPE_BYTAG(Grasp);
+	return GetStore().FindOrAdd(Handle);
+}
+
+void FGraspSelectionContext::Remove(const FTargetingRequestHandle& Handle)
+{
+	check(IsInGameThread());
+	GetStore().Remove(Handle);
+}
+
+SIZE_T FGraspSelectionContext::GetStoreAllocatedSize()
+{
+	check(IsInGameThread());
+	return GetStore().GetAllocatedSize();
+}
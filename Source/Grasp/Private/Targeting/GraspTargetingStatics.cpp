@@ -10,6 +10,9 @@
 #include "Components/PrimitiveComponent.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GraspableComponent.h"
+#include "GraspDataRuntime.h"
+#include "GraspData.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GraspTargetingStatics)
 
@@ -109,6 +112,17 @@ FQuat UGraspTargetingStatics::GetSourceRotation(const FTargetingRequestHandle& T
 			switch (RotationSource)
 			{
 			case EGraspTargetRotationSource::Actor: return SourceContext->SourceActor->GetActorQuat();
+			case EGraspTargetRotationSource::Camera:
+				{
+					// Falls through to ControlRotation when there is no camera, e.g. AI
+					if (const APlayerController* PC = Cast<APlayerController>(SourceContext->SourceActor->GetOwner()))
+					{
+						if (PC->PlayerCameraManager)
+						{
+							return PC->PlayerCameraManager->GetCameraRotation().Quaternion();
+						}
+					}
+				}
 			case EGraspTargetRotationSource::ControlRotation:
 				{
 					if (const APawn* Pawn = Cast<APawn>(SourceContext->SourceActor))
@@ -194,4 +208,49 @@ void UGraspTargetingStatics::InitCollisionParams(const FTargetingRequestHandle&
 	
 	// static const auto CVarComplexTracingAOE = IConsoleManager::Get().FindConsoleVariable(TEXT("ts.AOE.EnableComplexTracingAOE"));
 	// const bool bComplexTracingAOE = CVarComplexTracingAOE ? CVarComplexTracingAOE->GetBool() : true;
-}
\ No newline at end of file
+}
+
+void UGraspTargetingStatics::GetGraspScanResults(const FTargetingRequestHandle& TargetingHandle,
+	const FGameplayTag& ScanTag, TArray<FGraspScanResult>& OutResults)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(GraspTargetingStatics::GetGraspScanResults);
+
+	if (!TargetingHandle.IsValid())
+	{
+		return;
+	}
+
+	// Process results
+	if (FTargetingDefaultResultsSet* Results = FTargetingDefaultResultsSet::Find(TargetingHandle))
+	{
+		OutResults.Reserve(OutResults.Num() + Results->TargetResults.Num());
+		for (FTargetingDefaultResultData& ResultData : Results->TargetResults)
+		{
+			AddGraspScanResult(ResultData.HitResult, ScanTag, OutResults);
+		}
+	}
+}
+
+bool UGraspTargetingStatics::AddGraspScanResult(FHitResult& Hit, const FGameplayTag& ScanTag,
+	TArray<FGraspScanResult>& OutResults)
+{
+	// Requires a valid component
+	if (!Hit.GetComponent())
+	{
+		return false;
+	}
+
+	const IGraspableComponent* Graspable = CastChecked<IGraspableComponent>(Hit.GetComponent());  // Filtering already checked the type and data
+	const FVector Location = Hit.GetComponent()->GetComponentLocation();
+
+	// Calculate the normalized distance
+	const float GraspAbilityRadius = Hit.Distance;  // Targeting output the GraspAbilityRadius as Distance
+	Hit.Distance = Graspable->GetGraspDataRuntime()->bGrantAbilityDistance2D ?
+		FVector::Dist2D(Location, Hit.TraceStart) :
+		FVector::Dist(Location, Hit.TraceStart);
+	const float NormalizedDistance = Hit.Distance / GraspAbilityRadius;
+
+	// Add the result to the array
+	OutResults.Emplace(ScanTag, Hit.GetComponent(), NormalizedDistance);
+	return true;
+}
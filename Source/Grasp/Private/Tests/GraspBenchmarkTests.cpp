@@ -0,0 +1,202 @@
+﻿// Copyright (c) Jared Taylor
+
+
+#include "GraspBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GraspData.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+
+namespace FGraspCVars
+{
+	static FString BenchGraspData;
+	FAutoConsoleVariableRef CVarBenchGraspData(
+		TEXT("p.Grasp.Bench.GraspData"),
+		BenchGraspData,
+		TEXT("GraspData asset path used by the Grasp.Benchmark.Scan and Grasp.Benchmark.Bandwidth automation tests, which are only listed once this is set"),
+		ECVF_Default);
+}
+
+namespace GraspBenchmarkTests
+{
+	/** Filled in by the benchmark when it finishes, the latent command waits on it */
+	struct FBenchmarkState
+	{
+		bool bFinished = false;
+		FGraspBenchmarkReport Report;
+	};
+
+	/** The game or PIE world with a local player, the pawn benchmarks need one to walk */
+	static UWorld* FindLocalPlayerWorld()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (World && (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && World->GetFirstPlayerController())
+			{
+				return World;
+			}
+		}
+		return nullptr;
+	}
+
+	/** The server world in this process, e.g. PIE as a listen server */
+	static UWorld* FindServerWorld()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (World && (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) &&
+				(World->GetNetMode() == NM_ListenServer || World->GetNetMode() == NM_DedicatedServer))
+			{
+				return World;
+			}
+		}
+		return nullptr;
+	}
+
+	/** Fail the test for every failure in the report, which includes regressions when p.Grasp.Bench.Baseline is 2 */
+	static bool ReportFailures(FAutomationTestBase& Test, const FGraspBenchmarkReport& Report)
+	{
+		for (const FString& Failure : Report.Failures)
+		{
+			Test.AddError(FString::Printf(TEXT("Grasp benchmark %s: %s"), *Report.Name, *Failure));
+		}
+		return Report.HasPassed();
+	}
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FGraspWaitForBenchmarkCommand, FAutomationTestBase*, Test,
+	TSharedRef<GraspBenchmarkTests::FBenchmarkState>, State);
+
+bool FGraspWaitForBenchmarkCommand::Update()
+{
+	if (!State->bFinished)
+	{
+		return false;
+	}
+
+	GraspBenchmarkTests::ReportFailures(*Test, State->Report);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGraspBenchmarkStaticsTest, "Grasp.Benchmark.Statics",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::ProductFilter)
+
+bool FGraspBenchmarkStaticsTest::RunTest(const FString& Parameters)
+{
+	// A transient world so the test doesn't depend on the map that is open
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	FGraspBenchmarkReport Report = FGraspBenchmark::RunStatics(World, FGraspBenchmark::DefaultIterations, FGraspBenchmark::DefaultSeed);
+	FGraspBenchmark::Finish(Report, *GLog);
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return GraspBenchmarkTests::ReportFailures(*this, Report);
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGraspBenchmarkScanTest, "Grasp.Benchmark.Scan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+void FGraspBenchmarkScanTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	// Needs the project's GraspData and a running game, e.g. PIE
+	if (!FGraspCVars::BenchGraspData.IsEmpty())
+	{
+		OutBeautifiedNames.Add(FPaths::GetBaseFilename(FGraspCVars::BenchGraspData));
+		OutTestCommands.Add(FGraspCVars::BenchGraspData);
+	}
+}
+
+bool FGraspBenchmarkScanTest::RunTest(const FString& Parameters)
+{
+	const UGraspData* GraspData = LoadObject<UGraspData>(nullptr, *Parameters);
+	if (!GraspData)
+	{
+		AddError(FString::Printf(TEXT("Could not load the GraspData %s"), *Parameters));
+		return false;
+	}
+
+	UWorld* World = GraspBenchmarkTests::FindLocalPlayerWorld();
+	if (!World)
+	{
+		AddError(TEXT("Needs a game world with a local player, e.g. run it during PIE"));
+		return false;
+	}
+
+	const TSharedRef<GraspBenchmarkTests::FBenchmarkState> State = MakeShared<GraspBenchmarkTests::FBenchmarkState>();
+	const bool bStarted = FGraspBenchmark::StartScan(World, GraspData, FGraspBenchmark::DefaultFrames, FGraspBenchmark::DefaultSeed,
+		FGraspBenchmark::DefaultGraspables, *GLog, [State](const FGraspBenchmarkReport& Report)
+		{
+			State->Report = Report;
+			State->bFinished = true;
+		});
+
+	if (!bStarted)
+	{
+		AddError(TEXT("The scan benchmark could not start, see the log"));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FGraspWaitForBenchmarkCommand(this, State));
+	return true;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FGraspBenchmarkBandwidthTest, "Grasp.Benchmark.Bandwidth",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::ProductFilter)
+
+void FGraspBenchmarkBandwidthTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	// Needs the project's GraspData and a server with clients connected, e.g. PIE as a listen server
+	if (!FGraspCVars::BenchGraspData.IsEmpty())
+	{
+		OutBeautifiedNames.Add(FPaths::GetBaseFilename(FGraspCVars::BenchGraspData));
+		OutTestCommands.Add(FGraspCVars::BenchGraspData);
+	}
+}
+
+bool FGraspBenchmarkBandwidthTest::RunTest(const FString& Parameters)
+{
+	const UGraspData* GraspData = LoadObject<UGraspData>(nullptr, *Parameters);
+	if (!GraspData)
+	{
+		AddError(FString::Printf(TEXT("Could not load the GraspData %s"), *Parameters));
+		return false;
+	}
+
+	UWorld* World = GraspBenchmarkTests::FindServerWorld();
+	if (!World)
+	{
+		AddError(TEXT("Needs a server world with clients connected, e.g. run it during PIE as a listen server with 2 or more players"));
+		return false;
+	}
+
+	const TSharedRef<GraspBenchmarkTests::FBenchmarkState> State = MakeShared<GraspBenchmarkTests::FBenchmarkState>();
+	const bool bStarted = FGraspBenchmark::StartBandwidth(World, GraspData, FGraspBenchmark::DefaultFrames, FGraspBenchmark::DefaultSeed,
+		FGraspBenchmark::DefaultGraspables, *GLog, [State](const FGraspBenchmarkReport& Report)
+		{
+			State->Report = Report;
+			State->bFinished = true;
+		});
+
+	if (!bStarted)
+	{
+		AddError(TEXT("The bandwidth benchmark could not start, see the log"));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FGraspWaitForBenchmarkCommand(this, State));
+	return true;
+}
+
+#endif
@@ -0,0 +1,94 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/TargetingFilterTask_BasicFilterTemplate.h"
+#include "GraspFilterTask.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Everything a Grasp filter needs from the targeting request, resolved once per request instead of once per target
+ */
+struct GRASP_API FGraspFilterContext
+{
+	FTargetingRequestHandle TargetingHandle;
+
+	/** The targeting source, nullptr if the request has none */
+	AActor* SourceActor = nullptr;
+
+	/** SourceActor's location */
+	FVector SourceLocation = FVector::ZeroVector;
+
+	/** @see FGraspDataRuntime::GetNetToleranceIndex() */
+	int32 NetToleranceIndex = 0;
+
+	static FGraspFilterContext Make(const FTargetingRequestHandle& TargetingHandle);
+};
+
+/**
+ * Base for Grasp filters
+ * Filters implement ShouldFilterGraspTarget(), which is used by both the Targeting System and the native scan backend
+ * ShouldFilterTarget() is final so that existing overrides fail to compile instead of being bypassed
+ * @see EGraspScanBackend
+ */
+UCLASS(Abstract)
+class GRASP_API UGraspFilterTask : public UTargetingFilterTask_BasicFilterTemplate
+{
+	GENERATED_BODY()
+
+public:
+	UGraspFilterTask(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/** Filters the results in a single pass, preserving their order */
+	virtual void Execute(const FTargetingRequestHandle& TargetingHandle) const override;
+
+	/** Forwards to ShouldFilterGraspTarget(), override that instead */
+	virtual bool ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle, const FTargetingDefaultResultData& TargetData) const override final;
+
+	/**
+	 * Called against every target to determine if it should be filtered out
+	 * @return True to filter out the target
+	 */
+	virtual bool ShouldFilterGraspTarget(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent) const
+	{
+		return false;
+	}
+
+	/**
+	 * Override to return true if this filter rejects every target beyond FGraspDataRuntimeTable::GetMaxRangeSq()
+	 * Evaluation then stops at the first such target, UGraspTargetSelection sorts the results nearest first
+	 */
+	virtual bool FiltersBeyondMaxRange() const { return false; }
+
+	/**
+	 * Index of the first target beyond the max range of every UGraspData, or the number of results if there is none
+	 * Only cuts off results that FGraspTargetingRequestData::bSortedByDistance says were sorted by UGraspTargetSelection
+	 * and only once a UGraspData has registered a max range
+	 * @see UGraspTargetSelection::bSortByDistance
+	 */
+	static int32 GetMaxRangeCutoff(const FGraspFilterContext& Context, const TArray<FTargetingDefaultResultData>& TargetResults);
+
+	/** Record the number of targets before and after this filter, if the Gameplay Debugger is inspecting the request */
+	void RecordFilterCount(const FTargetingRequestHandle& TargetingHandle, int32 NumBefore, int32 NumAfter) const;
+
+#if ENABLE_DRAW_DEBUG
+	/** @return True if the Targeting System debugger is enabled, Execute() then records the targets it filters */
+	static bool IsTargetingDebuggingEnabled();
+
+	/** Record a filtered target for the Targeting System debugger, in place of the base Execute() */
+	void AddDebugFilteredTarget(const FTargetingRequestHandle& TargetingHandle, const FTargetingDefaultResultData& TargetData) const;
+
+	/** Discard the filtered targets recorded by the last request */
+	void ResetDebugFilteredTargets(const FTargetingRequestHandle& TargetingHandle) const;
+#endif
+
+#if ENABLE_VISUAL_LOG
+	/** Record the rejected target to the Visual Logger of the source actor */
+	void VisLogRejected(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent) const;
+
+	/** Record the number of targets skipped for being beyond the max range */
+	static void VisLogSkippedBeyondMaxRange(const FGraspFilterContext& Context, int32 NumSkipped);
+#endif
+};
@@ -4,16 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "GraspTypes.h"
-#include "Tasks/TargetingFilterTask_BasicFilterTemplate.h"
+#include "GraspFilterTask.h"
 #include "GraspFilter_CanActivateAbility.generated.h"
 
 /**
  * Filter targets by whether they have a grasp ability that can be activated or not
  * (i.e. calls CanActivateAbility() on the ability itself, and pre-requisite checks)
  * Designed to be executed by Vigil, or any other focus system that uses Targeting System
+ * For UGraspInteractorComponent, IGraspableOwner::CanGraspInteract() is checked instead
  */
 UCLASS(Blueprintable, DisplayName="Grasp Filter (Can Activate Grasp Ability)")
-class GRASP_API UGraspFilter_CanActivateAbility : public UTargetingFilterTask_BasicFilterTemplate
+class GRASP_API UGraspFilter_CanActivateAbility : public UGraspFilterTask
 {
 	GENERATED_BODY()
 
@@ -25,6 +26,5 @@ public:
 public:
 	UGraspFilter_CanActivateAbility(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
-	/** Called against every target data to determine if the target should be filtered out */
-	virtual bool ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle, const FTargetingDefaultResultData& TargetData) const override;
+	virtual bool ShouldFilterGraspTarget(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent) const override;
 };
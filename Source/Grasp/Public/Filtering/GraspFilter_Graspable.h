@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Tasks/TargetingFilterTask_BasicFilterTemplate.h"
+#include "GraspFilterTask.h"
 #include "GraspFilter_Graspable.generated.h"
 
 /**
@@ -11,13 +11,12 @@
  * Mandatory for Grasp interaction -- no other implement checks are performed
  */
 UCLASS(Blueprintable, DisplayName="Grasp Filter (Graspable Interface)")
-class GRASP_API UGraspFilter_Graspable : public UTargetingFilterTask_BasicFilterTemplate
+class GRASP_API UGraspFilter_Graspable : public UGraspFilterTask
 {
 	GENERATED_BODY()
 
 public:
 	UGraspFilter_Graspable(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
-	/** Called against every target data to determine if the target should be filtered out */
-	virtual bool ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle, const FTargetingDefaultResultData& TargetData) const override;
+	virtual bool ShouldFilterGraspTarget(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent) const override;
 };
@@ -4,7 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GraspTypes.h"
-#include "Tasks/TargetingFilterTask_BasicFilterTemplate.h"
+#include "GraspFilterTask.h"
 #include "GraspFilter_IsWithinGraspableHeight.generated.h"
 
 
@@ -12,7 +12,7 @@
  * Filter targets by whether they are within the parameters defined in UGraspData such as the angle and distance
  */
 UCLASS(Blueprintable, DisplayName="Grasp Filter (Graspable Height)")
-class GRASP_API UGraspFilter_IsWithinGraspableHeight : public UTargetingFilterTask_BasicFilterTemplate
+class GRASP_API UGraspFilter_IsWithinGraspableHeight : public UGraspFilterTask
 {
 	GENERATED_BODY()
 
@@ -27,6 +27,5 @@ public:
 public:
 	UGraspFilter_IsWithinGraspableHeight(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
-	/** Called against every target data to determine if the target should be filtered out */
-	virtual bool ShouldFilterTarget(const FTargetingRequestHandle& TargetingHandle, const FTargetingDefaultResultData& TargetData) const override;
+	virtual bool ShouldFilterGraspTarget(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent) const override;
 };
@@ -0,0 +1,118 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraspFilterTask.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/ObjectKey.h"
+#include "Targeting/GraspTargetingTypes.h"
+#include "GraspFilter_LineOfSight.generated.h"
+
+struct FTraceDatum;
+struct FTraceHandle;
+
+/** Cached visibility between an interactor and a graspable */
+struct GRASP_API FGraspLineOfSightCacheEntry
+{
+	/** Where the trace was performed from and to, the entry is invalidated if either moves too far */
+	FVector TraceStart = FVector::ZeroVector;
+	FVector TraceEnd = FVector::ZeroVector;
+
+	/** World time the trace completed */
+	float Time = 0.f;
+
+	bool bVisible = false;
+};
+
+/**
+ * Filter targets that are not visible to the targeting source
+ * Visibility is cached per interactor and graspable for CacheDuration, or until either moves more than InvalidationDistance
+ * Async targeting requests trace all uncached targets asynchronously and filter from those results once they complete
+ * Immediate requests and the native scan backend trace synchronously
+ * Line traces are by far the most expensive filter, add this last so it only traces targets that pass the other filters
+ */
+UCLASS(Blueprintable, DisplayName="Grasp Filter (Line of Sight)")
+class GRASP_API UGraspFilter_LineOfSight : public UGraspFilterTask
+{
+	GENERATED_BODY()
+
+public:
+	/** Location to trace from, typically ViewLocation or Camera so we can interact with what we can see */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter")
+	EGraspTargetLocationSource LocationSource = EGraspTargetLocationSource::ViewLocation;
+
+	/** Channel to trace on, anything that blocks it occludes the graspable */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	/** When enabled, the trace will be performed against complex collision */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter")
+	bool bTraceComplex = false;
+
+	/** How long a trace result remains valid, 0 to trace every scan */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter", meta=(UIMin="0", ClampMin="0", ForceUnits="s"))
+	float CacheDuration = 0.2f;
+
+	/** Trace results are invalidated if the interactor or graspable moves further than this, 0 to ignore movement */
+	UPROPERTY(EditAnywhere, Category="Grasp Filter", meta=(UIMin="0", ClampMin="0", ForceUnits="cm"))
+	float InvalidationDistance = 25.f;
+
+public:
+	UGraspFilter_LineOfSight(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void Execute(const FTargetingRequestHandle& TargetingHandle) const override;
+
+	virtual bool ShouldFilterGraspTarget(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent) const override;
+
+protected:
+	/** Where to trace from for this request */
+	FVector GetTraceStart(const FGraspFilterContext& Context) const;
+
+	/** Where to trace to for this target */
+	static FVector GetTraceEnd(const UPrimitiveComponent* TargetComponent);
+
+	/** @return The cached entry if it is still valid */
+	const FGraspLineOfSightCacheEntry* FindCacheEntry(const UWorld* World, const AActor* Interactor,
+		const UPrimitiveComponent* TargetComponent, const FVector& TraceStart, const FVector& TraceEnd) const;
+
+	/** Store a trace result */
+	void AddCacheEntry(const UWorld* World, const AActor* Interactor, const UPrimitiveComponent* TargetComponent,
+		const FVector& TraceStart, const FVector& TraceEnd, bool bVisible) const;
+
+	/** Remove entries that have expired or whose interactor or graspable were destroyed */
+	void PruneCache(const UWorld* World) const;
+
+	/** Setup CollisionQueryParams for the trace */
+	void InitCollisionParams(const FGraspFilterContext& Context, const UPrimitiveComponent* TargetComponent,
+		FCollisionQueryParams& OutParams) const;
+
+	/** Callback for an async trace */
+	void HandleAsyncTraceComplete(const FTraceHandle& InTraceHandle, FTraceDatum& InTraceDatum,
+		FTargetingRequestHandle TargetingHandle, uint32 Serial, TWeakObjectPtr<const AActor> Interactor,
+		TWeakObjectPtr<const UPrimitiveComponent> TargetComponent) const;
+
+	/** Remove every target that is not visible according to the results gathered for the request, then complete the task */
+	void FilterFromTraceResults(const FTargetingRequestHandle& TargetingHandle, const TMap<FObjectKey, bool>& Visibility) const;
+
+protected:
+	/** Visibility keyed by interactor and graspable, shared by every request that uses this preset */
+	mutable TMap<TPair<FObjectKey, FObjectKey>, FGraspLineOfSightCacheEntry> Cache;
+
+	/** Outstanding async traces per request */
+	struct FPendingTraces
+	{
+		uint32 Serial = 0;
+		int32 NumPending = 0;
+
+		/** Visibility of each target component, from the cache or the async traces, the request is filtered from this */
+		TMap<FObjectKey, bool> Visibility;
+	};
+	mutable TMap<FTargetingRequestHandle, FPendingTraces> PendingTraces;
+
+	/** Identifies the traces issued by a request so results for a previous use of a reused handle are not applied to it */
+	mutable uint32 NextSerial = 0;
+
+	/** World time the cache was last pruned */
+	mutable float LastPruneTime = 0.f;
+};
@@ -4,7 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "GameplayAbilitySpecHandle.h"
+#include "GraspTypes.h"
 #include "Abilities/GameplayAbility.h"
+#include "UObject/ObjectKey.h"
 #include "GraspAbilityData.generated.h"
 
 /**
@@ -40,4 +42,45 @@ struct GRASP_API FGraspAbilityData
 	/** Interactables that are in range and require this ability remain active */
 	UPROPERTY()
 	TArray<TWeakObjectPtr<const UPrimitiveComponent>> Graspables;
+};
+
+/**
+ * Identifies a UGraspStatics::CanGraspActivateAbility() query
+ * @see UGraspComponent::bMemoizeCanActivateAbility
+ */
+struct FGraspCanActivateMemoKey
+{
+	FGameplayAbilitySpecHandle Handle;
+
+	/** The spec's level and input, the handle stays the same when they change */
+	int32 Level = 0;
+	int32 InputID = INDEX_NONE;
+
+	FObjectKey Graspable;
+	FObjectKey SourceActor;
+	EGraspAbilityComponentSource Source = EGraspAbilityComponentSource::EventData;
+
+	bool operator==(const FGraspCanActivateMemoKey& Other) const
+	{
+		return Handle == Other.Handle && Level == Other.Level && InputID == Other.InputID && Graspable == Other.Graspable &&
+			SourceActor == Other.SourceActor && Source == Other.Source;
+	}
+
+	friend uint32 GetTypeHash(const FGraspCanActivateMemoKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.Handle), GetTypeHash(Key.Level));
+		Hash = HashCombine(Hash, GetTypeHash(Key.InputID));
+		Hash = HashCombine(Hash, GetTypeHash(Key.Graspable));
+		Hash = HashCombine(Hash, GetTypeHash(Key.SourceActor));
+		return HashCombine(Hash, GetTypeHash(Key.Source));
+	}
+};
+
+/** Memoized result of a UGraspStatics::CanGraspActivateAbility() query */
+struct FGraspCanActivateMemoEntry
+{
+	/** World time the result was evaluated */
+	float Time = 0.f;
+
+	bool bCanActivate = false;
 };
\ No newline at end of file
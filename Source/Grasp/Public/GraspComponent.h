@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ActiveGameplayEffectHandle.h"
 #include "GameplayAbilitySpecHandle.h"
 #include "GameplayTagContainer.h"
 #include "GraspAbilityData.h"
@@ -10,16 +11,53 @@
 #include "GraspTags.h"
 #include "GraspTypes.h"
 #include "Components/ActorComponent.h"
+#include "Targeting/GraspTargetingRequestData.h"
 #include "Types/TargetingSystemTypes.h"
 #include "GraspComponent.generated.h"
 
 struct FGameplayAbilitySpec;
 struct FGameplayAbilityActorInfo;
 struct FGameplayAbilitySpecHandle;
+struct FGameplayEffectSpec;
+struct FActiveGameplayEffect;
+struct FAbilityEndedData;
 class UGraspData;
 class UGameplayAbility;
 class UAbilitySystemComponent;
 class AController;
+class APawn;
+class UTargetingPreset;
+class UTargetingSubsystem;
+struct FStreamableHandle;
+
+/** Bytes allocated by a UGraspComponent's containers, reported by p.Grasp.MemReport */
+struct FGraspMemoryUsage
+{
+	/** AbilityData and the graspables tracked by each entry */
+	SIZE_T AbilityData = 0;
+
+	/** CurrentScanResults */
+	SIZE_T ScanResults = 0;
+
+	/** Targeting request handles, presets and scan LOD candidates */
+	SIZE_T Targeting = 0;
+
+	/** CanActivateMemo, Gameplay Debugger diagnostics and grant latency scans */
+	SIZE_T Other = 0;
+
+	SIZE_T GetTotal() const { return AbilityData + ScanResults + Targeting + Other; }
+};
+
+#if !UE_BUILD_SHIPPING
+/** Previous results of a targeting preset, used to estimate when a graspable entered grant range */
+struct FGraspGrantLatencyScan
+{
+	/** World time of the previous GraspTargetsReady() for the preset */
+	double Time = -1.0;
+
+	TArray<FGraspScanResult> Results;
+};
+#endif
 
 /**
  * Add to your Controller
@@ -39,6 +77,13 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp)
 	TArray<TSubclassOf<UGameplayAbility>> CommonGraspAbilities;
 
+	/**
+	 * Soft referenced grasp abilities that are loaded asynchronously by InitializeGrasp() and kept resident
+	 * Use for UGraspData::SoftGraspAbility that must be granted without waiting for a load
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp)
+	TArray<TSoftClassPtr<UGameplayAbility>> PreloadGraspAbilities;
+
 	/** Targeting presets for finding graspables to interact with, used unless overriding GetTargetingPresets() */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp)
 	TMap<FGameplayTag, TObjectPtr<UTargetingPreset>> DefaultTargetingPresets = { { FGraspTags::Grasp_Interact, nullptr } };
@@ -50,7 +95,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
 	EGraspTargetingSource DefaultTargetingSource = EGraspTargetingSource::Pawn;
 
-	/** If true, each Grasp request will update targeting presets before proceeding */
+	/**
+	 * If true, GetMaxGraspScanRate() and GetTargetingSource() are evaluated once and cached
+	 * Call the Invalidate functions when the values returned by your overrides change
+	 * The targeting source is invalidated automatically when the possessed pawn changes
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	bool bCacheGraspScanParameters = false;
+
+	/**
+	 * If true, each Grasp request will update targeting presets before proceeding
+	 * Otherwise they are only updated after InvalidateTargetingPresets()
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
 	bool bUpdateTargetingPresetsOnUpdate = false;
 
@@ -62,6 +118,52 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
 	bool bEndTargetingRequestsOnPawnChange = false;
 
+	/**
+	 * If true, scanning is split into two tiers
+	 * The coarse tier runs the targeting presets normally every CoarseScanInterval and keeps every overlapped component as a candidate
+	 * The fine tier runs at GetMaxGraspScanRate() and re-evaluates only those candidates, without an overlap
+	 * The selection shape of each preset should cover the MaxHighlightDistance of your graspables
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	bool bEnableScanLOD = false;
+
+	/** How often the coarse tier runs the overlap when bEnableScanLOD is true */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp, meta=(UIMin="0", ClampMin="0", ForceUnits="s", EditCondition="bEnableScanLOD"))
+	float CoarseScanInterval = 1.f;
+
+	/**
+	 * If true, each targeting preset keeps one targeting request handle alive and re-queues it every scan
+	 * Avoids allocating and releasing the Targeting System's data stores for every scan
+	 * If false, a new handle is made every scan and released on completion
+	 * Compare both with p.Grasp.Bench.Scan and p.Grasp.Bench.ReuseHandles before enabling it
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category=Grasp)
+	bool bReuseTargetingRequestHandles = false;
+
+	/**
+	 * How the targeting presets are run
+	 * Native runs presets made of a UGraspTargetSelection followed only by Grasp filters synchronously without the TargetingSubsystem
+	 * Any other preset always runs through the TargetingSubsystem
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	EGraspScanBackend ScanBackend = EGraspScanBackend::TargetingSystem;
+
+	/**
+	 * If true, CanGraspActivateAbility() results are memoized per ability spec and graspable
+	 * The memo is invalidated when the ASC's owned tags change, a gameplay effect is applied or removed, or an ability is activated or ended
+	 * Abilities that check state the ASC doesn't know about should not rely on this, or call InvalidateCanActivateMemo() when it changes
+	 * Takes effect on the next InitializeGrasp()
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	bool bMemoizeCanActivateAbility = false;
+
+	/**
+	 * Memoized results are re-evaluated after this long regardless
+	 * Catches changes that don't invalidate the memo, e.g. replicated attributes used by ability costs
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp, meta=(UIMin="0", ClampMin="0", ForceUnits="s", EditCondition="bMemoizeCanActivateAbility"))
+	float CanActivateMemoDuration = 0.5f;
+
 public:
 	/** Track any change in preset update mode so we can rebind delegates as required */
 	UPROPERTY(Transient)
@@ -82,6 +184,63 @@ public:
 	/** Handle for the GraspScanAbility */
 	FGameplayAbilitySpecHandle ScanAbilityHandle;
 	
+protected:
+	/** Cached GetMaxGraspScanRate(), unset when invalidated */
+	mutable TOptional<float> CachedMaxGraspScanRate;
+
+	/** Cached GetTargetingSource() */
+	mutable TWeakObjectPtr<AActor> CachedTargetingSource;
+
+	/** Possessed pawn when CachedTargetingSource was evaluated */
+	mutable TWeakObjectPtr<const APawn> CachedTargetingSourcePawn;
+
+	/** Incremented by InvalidateTargetingPresets() */
+	uint32 TargetingPresetsVersion = 0;
+
+	/** TargetingPresetsVersion that CurrentTargetingPresets was built from */
+	uint32 CurrentTargetingPresetsVersion = 0;
+
+	/** Scan LOD candidates for each targeting preset */
+	TMap<FGameplayTag, FGraspScanLODState> ScanLODStates;
+
+	/** Targeting request handles kept alive between scans when bReuseTargetingRequestHandles is true */
+	TMap<FGameplayTag, FGraspPersistentTargetingRequest> PersistentTargetingRequests;
+
+	/** Memoized CanGraspActivateAbility() results when bMemoizeCanActivateAbility is true */
+	TMap<FGraspCanActivateMemoKey, FGraspCanActivateMemoEntry> CanActivateMemo;
+
+	/** Whether the ASC delegates that invalidate CanActivateMemo are bound */
+	bool bCanActivateMemoBound = false;
+
+	FDelegateHandle OwnedTagsChangedHandle;
+	FDelegateHandle EffectAppliedHandle;
+	FDelegateHandle EffectRemovedHandle;
+	FDelegateHandle AbilityActivatedHandle;
+	FDelegateHandle AbilityEndedHandle;
+
+	/** FPlatformTime::Seconds() the Gameplay Debugger last inspected us, scan diagnostics are only collected shortly after */
+	double ScanDebugRequestTime = -1.0;
+
+	/** Scan diagnostics for each targeting preset, collected while the Gameplay Debugger inspects us */
+	TMap<FGameplayTag, FGraspScanDebugInfo> ScanDebugInfo;
+
+	/** Game thread cost of recent scan requests in milliseconds, oldest first */
+	TArray<float> ScanCostHistory;
+
+	/** Sum and number of every cost passed to AddScanDebugCost(), for benchmarks that outlive ScanCostHistory */
+	double TotalScanDebugCost = 0.0;
+	int32 NumScanDebugCosts = 0;
+
+	/** Number of abilities granted by GraspTargetsReady() */
+	int32 NumGraspAbilitiesGranted = 0;
+
+#if !UE_BUILD_SHIPPING
+	/** Each preset's results arrive in their own GraspTargetsReady(), only kept while grant latency is recorded */
+	TMap<FGameplayTag, FGraspGrantLatencyScan> GrantLatencyScans;
+#endif
+
+	friend class FGameplayDebuggerCategory_Grasp;
+
 protected:
 	/** Owning controller */
 	UPROPERTY(Transient, DuplicateTransient)
@@ -113,6 +272,9 @@ protected:
 	/** The ASC we were initialized with */
 	TWeakObjectPtr<UAbilitySystemComponent> ASC;
 
+	/** Keeps PreloadGraspAbilities resident */
+	TSharedPtr<FStreamableHandle> PreloadGraspAbilitiesHandle;
+
 public:
 	UAbilitySystemComponent* GetASC() { return ASC.IsValid() ? ASC.Get() : nullptr; }
 	const UAbilitySystemComponent* GetASC() const { return ASC.IsValid() ? ASC.Get() : nullptr; }
@@ -145,6 +307,12 @@ public:
 public:
 	UGraspComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+	/** Bytes allocated by our containers, excludes the granted abilities themselves which the ASC owns */
+	FGraspMemoryUsage GetGraspMemoryUsage() const;
+
 	/**
 	 * Call when your Pawn receives a controller
 	 * Must be called on both authority and local client
@@ -171,6 +339,90 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category=Grasp)
 	TMap<FGameplayTag, UTargetingPreset*> GetTargetingPresets() const;
 
+	/** GetMaxGraspScanRate(), cached if bCacheGraspScanParameters */
+	float GetCachedMaxGraspScanRate() const;
+
+	/** GetTargetingSource(), cached if bCacheGraspScanParameters */
+	AActor* GetCachedTargetingSource() const;
+
+	/** Call when the value returned by GetMaxGraspScanRate() changes */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void InvalidateMaxGraspScanRate() { CachedMaxGraspScanRate.Reset(); }
+
+	/** Call when the actor returned by GetTargetingSource() changes, this is done for you when the possessed pawn changes */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void InvalidateTargetingSource()
+	{
+		CachedTargetingSource.Reset();
+		CachedTargetingSourcePawn.Reset();
+	}
+
+	/** Call when the presets returned by GetTargetingPresets() change, they are updated on the next Grasp request */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void InvalidateTargetingPresets() { ++TargetingPresetsVersion; }
+
+	/** @return True if InvalidateTargetingPresets() was called since CurrentTargetingPresets was last updated */
+	bool AreTargetingPresetsDirty() const { return TargetingPresetsVersion != CurrentTargetingPresetsVersion; }
+
+	/** Discard the scan LOD candidates so the next scan of each preset is coarse */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void InvalidateScanLOD() { ScanLODStates.Reset(); }
+
+	/** Assign the scan LOD tier to a targeting request before it starts */
+	void PrepareScanLODRequest(const FGameplayTag& ScanTag, const FTargetingRequestHandle& TargetingHandle);
+
+	/** Retain the candidates gathered by a coarse request, call once the request completes */
+	void CompleteScanLODRequest(const FGameplayTag& ScanTag, const FTargetingRequestHandle& TargetingHandle);
+
+	/**
+	 * Get a targeting request handle for the preset, ready to be started
+	 * Reuses and resets the persistent handle for the preset if bReuseTargetingRequestHandles is true, otherwise makes a new one
+	 */
+	FTargetingRequestHandle AcquireTargetingRequestHandle(UTargetingSubsystem* TargetSubsystem, const FGameplayTag& ScanTag,
+		const UTargetingPreset* Preset, AActor* TargetingSource);
+
+	/** Release the persistent targeting request handle for the preset, or all of them if the tag is empty */
+	void ReleasePersistentTargetingRequests(const FGameplayTag& ScanTag = FGameplayTag::EmptyTag);
+
+	/**
+	 * Find a memoized CanGraspActivateAbility() result
+	 * @return True if a valid result was found
+	 */
+	bool FindCanActivateMemo(const FGraspCanActivateMemoKey& Key, bool& bOutCanActivate) const;
+
+	/** Memoize a CanGraspActivateAbility() result, if bMemoizeCanActivateAbility is true */
+	void AddCanActivateMemo(const FGraspCanActivateMemoKey& Key, bool bCanActivate);
+
+	/** Discard every memoized CanGraspActivateAbility() result */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void InvalidateCanActivateMemo() { CanActivateMemo.Reset(); }
+
+	/** Called by the Gameplay Debugger each time it collects data, keeps scan diagnostics collecting */
+	void RequestScanDebugInfo() { ScanDebugRequestTime = FPlatformTime::Seconds(); }
+
+	/** @return True if the Gameplay Debugger has inspected us within the last second */
+	bool IsCollectingScanDebugInfo() const { return ScanDebugRequestTime >= 0.0 && FPlatformTime::Seconds() - ScanDebugRequestTime < 1.0; }
+
+	/** Add the game thread cost of a scan request to ScanCostHistory */
+	void AddScanDebugCost(float Milliseconds);
+
+	double GetTotalScanDebugCost() const { return TotalScanDebugCost; }
+	int32 GetNumScanDebugCosts() const { return NumScanDebugCosts; }
+	int32 GetNumGraspAbilitiesGranted() const { return NumGraspAbilitiesGranted; }
+
+protected:
+	/** Bind to the ASC delegates that invalidate the CanActivateAbility memo */
+	void BindCanActivateMemo();
+	void UnbindCanActivateMemo();
+
+	void OnOwnedTagsChanged(const FGameplayTag Tag, int32 NewCount) { InvalidateCanActivateMemo(); }
+	void OnEffectApplied(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle) { InvalidateCanActivateMemo(); }
+	void OnEffectRemoved(const FActiveGameplayEffect& Effect) { InvalidateCanActivateMemo(); }
+	void OnAbilityActivated(UGameplayAbility* Ability) { InvalidateCanActivateMemo(); }
+	void OnAbilityEnded(const FAbilityEndedData& Data) { InvalidateCanActivateMemo(); }
+
+public:
+
 	/** Find the ability data mapped to the ability class */
 	const FGraspAbilityData* GetGraspAbilityData(const TSubclassOf<UGameplayAbility>& Ability) const;
 	
@@ -184,7 +436,7 @@ public:
 
 	/**
 	 * Retrieves new CurrentTargetingPresets
-	 * Ends any requests that are no longer current
+	 * Ends any in-progress requests for presets that were removed or replaced
 	 */
 	void UpdateTargetingPresets();
 
@@ -195,8 +447,9 @@ public:
 	/**
 	 * Notified by UGraspScanTask that our targets are ready
 	 * Cache the results and notify any listeners
+	 * @param ScanTag The targeting preset the results are from
 	 */
-	void GraspTargetsReady(const TArray<FGraspScanResult>& Results);
+	void GraspTargetsReady(const FGameplayTag& ScanTag, const TArray<FGraspScanResult>& Results);
 
 	/** Extension point called after giving grasp ability */
 	UFUNCTION(BlueprintNativeEvent, Category=Grasp)
@@ -8,6 +8,7 @@
 #include "GraspData.generated.h"
 
 class UGameplayAbility;
+struct FStreamableHandle;
 
 /**
  * Data representing an interactable
@@ -20,6 +21,8 @@ class GRASP_API UGraspData : public UDataAsset
 {
 	GENERATED_BODY()
 
+	friend class FGraspDataRuntimeTable;
+
 public:
 	UGraspData()
 		: GraspAbility(nullptr)
@@ -35,6 +38,8 @@ public:
 		, bManualClearAbility(false)
 		, bGrantAbilityDistance2D(false)
 		, bGraspDistance2D(false)
+		, bPersistentAbility(false)
+		, bCanActivateWithoutTargetData(false)
 		, InputTag(FGameplayTag::EmptyTag)
 	{}
 
@@ -46,11 +51,56 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Grasp)
 	TSubclassOf<UGameplayAbility> GraspAbility;
 
+	/**
+	 * Soft referenced alternative to GraspAbility, used only if GraspAbility is not set
+	 * Loaded asynchronously when a graspable using this data first enters scan range, the ability is granted once loaded
+	 * Use this to avoid loading every interaction ability in the level up-front
+	 * Abilities that must always be resident can be added to UGraspComponent::PreloadGraspAbilities
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Grasp, meta=(EditCondition="GraspAbility==nullptr"))
+	TSoftClassPtr<UGameplayAbility> SoftGraspAbility;
+
+	/** Keeps SoftGraspAbility resident once loaded */
+	mutable TSharedPtr<FStreamableHandle> GraspAbilityLoadHandle;
+
+	/** Time the async load was requested, for reporting load latency */
+	mutable double GraspAbilityLoadRequestTime = 0.0;
+
 public:
+	/**
+	 * The ability granted to the interactor
+	 * Returns nullptr while SoftGraspAbility is still loading
+	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category=Grasp)
 	TSubclassOf<UGameplayAbility> GetGraspAbility() const;
 	virtual TSubclassOf<UGameplayAbility> GetGraspAbility_Implementation() const;
 
+	/** The soft referenced ability, if any */
+	const TSoftClassPtr<UGameplayAbility>& GetSoftGraspAbility() const { return SoftGraspAbility; }
+
+	/** @return True if the ability is soft referenced and not yet loaded */
+	bool IsGraspAbilityLoadPending() const
+	{
+		return !GraspAbility && !SoftGraspAbility.IsNull() && !SoftGraspAbility.Get();
+	}
+
+	/**
+	 * Request an async load of SoftGraspAbility if it is not yet loaded
+	 * Does nothing if a load is already in-flight
+	 */
+	void RequestAsyncLoadGraspAbility() const;
+
+protected:
+	void OnGraspAbilityLoaded() const;
+
+	/** Index of our entry in FGraspDataRuntimeTable */
+	mutable int32 RuntimeIndex = INDEX_NONE;
+
+public:
+	virtual void PostLoad() override;
+	virtual void BeginDestroy() override;
+
+
 	/**
 	 * An optional property you can utilize to determine if the ability should be activable, or continue to be active, based on whether focus is lost
 	 * Pair this with Vigil or any other focus system
@@ -143,6 +193,22 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Grasp)
 	bool bGraspDistance2D;
+
+	/**
+	 * GraspAbility is a generic ability shared by many GraspData, parameterized by the GraspableComponent in the event data
+	 * Scanning never grants or clears it, add it to UGraspComponent::CommonGraspAbilities so it is pre-granted
+	 * The GraspableComponent is always sent with the event data, regardless of EGraspAbilityComponentSource
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Grasp)
+	bool bPersistentAbility;
+
+	/**
+	 * GraspAbility does not inspect the target data in ShouldAbilityRespondToEvent()
+	 * CanGraspActivateAbility() then only checks whether there is any target data instead of gathering it, see HasOptionalGraspTargetData()
+	 * Activation always gathers and sends the target data
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, AdvancedDisplay, Category=Grasp)
+	bool bCanActivateWithoutTargetData;
 	
 	/** 
 	 * Optional input tag - if set will be added to GetDynamicSpecSourceTags 
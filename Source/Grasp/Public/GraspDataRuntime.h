@@ -0,0 +1,181 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GraspTypes.h"
+#include "GameFramework/Actor.h"
+#include "Templates/SubclassOf.h"
+
+class UGraspData;
+class UGameplayAbility;
+
+/**
+ * UGraspData flattened into a single cache line for the scan hot paths
+ * Filters and GraspTargetsReady read this instead of dereferencing the UGraspData and calling its BlueprintNativeEvents
+ * Arrays are indexed by GetNetToleranceIndex(), [1] has the authority net tolerance applied
+ * Owned by FGraspDataRuntimeTable, do not hold a reference beyond the current scope
+ */
+struct alignas(PLATFORM_CACHE_LINE_SIZE) GRASP_API FGraspDataRuntime
+{
+	/** MaxGraspDistance squared */
+	float GraspDistanceSq[2] = { 0.f, 0.f };
+
+	/** MaxHighlightDistance squared, 0 if highlighting is disabled */
+	float HighlightDistanceSq[2] = { 0.f, 0.f };
+
+	/** Cosine of half MaxGraspAngle, below -1 if the angle covers the full circle */
+	float CosHalfAngle[2] = { -2.f, -2.f };
+
+	float MaxHeightAbove[2] = { 0.f, 0.f };
+	float MaxHeightBelow[2] = { 0.f, 0.f };
+
+	float NormalizedGrantAbilityDistance = 0.f;
+
+	uint8 bManualClearAbility : 1;
+	uint8 bGrantAbilityDistance2D : 1;
+	uint8 bGraspDistance2D : 1;
+
+	/** SoftGraspAbility has not loaded yet, Ability is null until it does */
+	uint8 bAbilityLoadPending : 1;
+
+	/** GetGraspAbility() is overridden in Blueprint and must be called every time */
+	uint8 bDynamicAbility : 1;
+
+	/** Ability is pre-granted and shared, never granted or cleared by scanning */
+	uint8 bPersistentAbility : 1;
+
+	/** CanGraspActivateAbility() does not gather target data for the ability */
+	uint8 bCanActivateWithoutTargetData : 1;
+
+	/** Resolved GetGraspAbility(), unless bDynamicAbility */
+	TSubclassOf<UGameplayAbility> Ability = nullptr;
+
+	/** The data this entry was compiled from */
+	const UGraspData* Source = nullptr;
+
+public:
+	FGraspDataRuntime()
+		: bManualClearAbility(false)
+		, bGrantAbilityDistance2D(false)
+		, bGraspDistance2D(false)
+		, bAbilityLoadPending(false)
+		, bDynamicAbility(false)
+		, bPersistentAbility(false)
+		, bCanActivateWithoutTargetData(false)
+	{}
+
+	/** @return 1 if the authority net tolerance applies to the Interactor, otherwise 0 */
+	static int32 GetNetToleranceIndex(const AActor* Interactor)
+	{
+		return Interactor->HasAuthority() && Interactor->GetNetMode() != NM_Standalone ? 1 : 0;
+	}
+
+	/** The ability granted to the interactor, nullptr while it is loading */
+	TSubclassOf<UGameplayAbility> GetGraspAbility() const;
+
+	/** Equivalent to UGraspStatics::CanInteractWithRange() without the normalized outputs */
+	EGraspQueryResult QueryRange(const FVector& InteractorLocation, const FVector& Location, int32 NetToleranceIndex) const
+	{
+		const float DistSq = FVector::DistSquared2D(Location, InteractorLocation);
+		if (DistSq <= GraspDistanceSq[NetToleranceIndex])
+		{
+			return EGraspQueryResult::Interact;
+		}
+		if (HighlightDistanceSq[NetToleranceIndex] > 0.f && DistSq <= HighlightDistanceSq[NetToleranceIndex])
+		{
+			return EGraspQueryResult::Highlight;
+		}
+		return EGraspQueryResult::None;
+	}
+
+	/** Equivalent to UGraspStatics::CanInteractWithAngle() without the normalized output */
+	bool QueryAngle(const FVector& InteractorLocation, const FVector& Location, const FVector& Forward, int32 NetToleranceIndex) const
+	{
+		const FVector Dir = (InteractorLocation - Location).GetSafeNormal2D();
+		return (Forward | Dir) >= CosHalfAngle[NetToleranceIndex];
+	}
+
+	/** Equivalent to UGraspStatics::CanInteractWithHeight() */
+	bool QueryHeight(const FVector& InteractorLocation, const FVector& Location, int32 NetToleranceIndex) const
+	{
+		const float Height = InteractorLocation.Z - Location.Z;
+		return Height >= -MaxHeightBelow[NetToleranceIndex] && Height <= MaxHeightAbove[NetToleranceIndex];
+	}
+
+	/** Equivalent to UGraspStatics::CanInteractWith() without the normalized outputs */
+	EGraspQueryResult Query(const FVector& InteractorLocation, const FVector& Location, const FVector& Forward, int32 NetToleranceIndex) const
+	{
+		const EGraspQueryResult Result = QueryRange(InteractorLocation, Location, NetToleranceIndex);
+		if (Result != EGraspQueryResult::Interact)
+		{
+			return Result;
+		}
+		if (!QueryAngle(InteractorLocation, Location, Forward, NetToleranceIndex) ||
+			!QueryHeight(InteractorLocation, Location, NetToleranceIndex))
+		{
+			return EGraspQueryResult::None;
+		}
+		return EGraspQueryResult::Interact;
+	}
+};
+
+static_assert(sizeof(FGraspDataRuntime) == PLATFORM_CACHE_LINE_SIZE, "FGraspDataRuntime should occupy a single cache line");
+
+/**
+ * Global table of compiled UGraspData, graspable components hold an index into it
+ * Entries are compiled when the UGraspData is loaded or edited, and released when it is destroyed
+ * Game thread only
+ */
+class GRASP_API FGraspDataRuntimeTable
+{
+public:
+	static FGraspDataRuntimeTable& Get();
+
+	/**
+	 * Compile the data into the table if it is not already
+	 * @return Index of the entry
+	 */
+	int32 Register(const UGraspData* Data);
+
+	/** Recompile the entry for the data if it is registered */
+	void Compile(const UGraspData* Data);
+
+	/** Release the entry for the data, the index may be reused */
+	void Release(const UGraspData* Data);
+
+	/** @return True if Index refers to the entry compiled from Data */
+	bool IsValidEntry(int32 Index, const UGraspData* Data) const
+	{
+		return Data && Entries.IsValidIndex(Index) && Entries[Index].Source == Data;
+	}
+
+	const FGraspDataRuntime& GetEntry(int32 Index) const
+	{
+		check(Entries.IsValidIndex(Index));
+		return Entries[Index];
+	}
+
+	/** Number of entries in use */
+	int32 Num() const { return Entries.Num() - FreeIndices.Num(); }
+
+	/**
+	 * Largest squared grasp or highlight distance of any entry, indexed by GetNetToleranceIndex()
+	 * Nothing further than this from the interactor can pass QueryRange()
+	 */
+	float GetMaxRangeSq(int32 NetToleranceIndex) const { return MaxRangeSq[NetToleranceIndex]; }
+
+	/** Bytes allocated by the table */
+	SIZE_T GetAllocatedSize() const { return Entries.GetAllocatedSize() + FreeIndices.GetAllocatedSize(); }
+
+private:
+	static void CompileEntry(const UGraspData* Data, FGraspDataRuntime& Entry);
+
+	/** Recalculate MaxRangeSq, entries change rarely so this iterates all of them */
+	void UpdateMaxRange();
+
+	TArray<FGraspDataRuntime> Entries;
+	TArray<int32> FreeIndices;
+
+	float MaxRangeSq[2] = { 0.f, 0.f };
+};
@@ -0,0 +1,89 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GraspEventLog.generated.h"
+
+UENUM()
+enum class EGraspEventType : uint8
+{
+	ScanIssued,
+	ScanCompleted,
+	NativeScan,
+	Grant,
+	Clear,
+	HangRecovered,
+	Pause,
+	Unpause,
+};
+
+/** A single compact entry in UGraspEventLog, names are only converted to strings when dumped */
+struct FGraspEvent
+{
+	/** World time the event was recorded */
+	double Time = 0.0;
+
+	/** Typically the UGraspComponent */
+	FObjectKey Source;
+
+	/** Typically the graspable component */
+	FObjectKey Target;
+
+	/** Names of the objects and their outers when recorded, objects destroyed since can still be identified */
+	FName SourceName;
+	FName SourceOuterName;
+	FName TargetName;
+	FName TargetOuterName;
+
+	/** Typically the scan tag */
+	FName Tag;
+
+	/** Candidate or result count, depending on the event */
+	int32 Value = 0;
+
+	EGraspEventType Type = EGraspEventType::ScanIssued;
+};
+
+/**
+ * Always-on, fixed size ring buffer of scan and grant activity for post-mortem diagnosis
+ * Recording copies a few words and formats nothing, use p.Grasp.EventLog.Dump to write it to a file
+ */
+UCLASS()
+class GRASP_API UGraspEventLog : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Record an event to the event log of the WorldContext's world, if enabled */
+	static void Record(const UObject* WorldContext, EGraspEventType Type, const UObject* Source,
+		const UObject* Target = nullptr, FName Tag = NAME_None, int32 Value = 0);
+
+	/** Add an event, overwriting the oldest once full */
+	void Add(EGraspEventType Type, const UObject* Source, const UObject* Target, FName Tag, int32 Value);
+
+	/** Visit the events from oldest to newest */
+	void ForEachEvent(TFunctionRef<void(const FGraspEvent&)> Func) const;
+
+	/** Write the events to a csv file, oldest first */
+	bool DumpToFile(const FString& Filename) const;
+
+	int32 Num() const { return Count; }
+
+	/** Bytes allocated by the ring buffer */
+	SIZE_T GetAllocatedSize() const { return Events.GetAllocatedSize(); }
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+protected:
+	TArray<FGraspEvent> Events;
+
+	/** Index the next event is written to */
+	int32 Head = 0;
+
+	/** Number of valid events, up to Events.Num() */
+	int32 Count = 0;
+};
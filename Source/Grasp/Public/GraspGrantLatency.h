@@ -0,0 +1,126 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#if !UE_BUILD_SHIPPING
+
+#include "CoreMinimal.h"
+#include "GameplayAbilitySpec.h"
+#include "Containers/Ticker.h"
+
+class UGraspComponent;
+class UWorld;
+
+/** Recent samples of a latency in seconds, percentiles follow the current session rather than its whole history */
+struct GRASP_API FGraspLatencyHistogram
+{
+	static constexpr int32 MaxSamples = 1024;
+
+	void Add(float Seconds);
+	void Reset();
+
+	/**
+	 * Samples are only sorted here, and only again once more have been added
+	 * @param Percentile 0 to 1
+	 */
+	float GetPercentile(float Percentile) const;
+
+	int32 Num() const { return Samples.Num(); }
+
+	/** Log the percentiles and the samples bucketed into 50ms bins */
+	void Log(FOutputDevice& Ar, const TCHAR* Label) const;
+
+protected:
+	TArray<float> Samples;
+
+	/** Next sample to overwrite once full */
+	int32 Head = 0;
+
+	/** Samples sorted by the last GetPercentile() */
+	mutable TArray<float> Sorted;
+	mutable bool bSorted = false;
+};
+
+/** Grant latencies recorded in a single map */
+struct GRASP_API FGraspMapGrantLatency
+{
+	/** From entering grant range to GiveAbility() on the server, mostly down to the scan rate */
+	FGraspLatencyHistogram ScanDelay;
+
+	/** From GiveAbility() on the server to the spec arriving on the owning client */
+	FGraspLatencyHistogram Replication;
+
+	/** From entering grant range to the ability being activatable on the owning client */
+	FGraspLatencyHistogram Total;
+};
+
+/**
+ * Measures the time between a player entering grant range of a graspable and the ability being activatable on their client
+ * Entering range is estimated on the server by interpolating NormalizedScanDistance between scans
+ * The spec arriving is detected by polling the client's ASC, so remote clients are only measured when they run in the
+ * same process as the server e.g. PIE, grants to other clients are only measured up to GiveAbility()
+ * Times are taken from the server's world, the same clock the scans run on
+ * Non-shipping and off by default, game thread only, see p.Grasp.Latency.Enable and p.Grasp.Latency.Report
+ */
+class GRASP_API FGraspGrantLatency
+{
+public:
+	static FGraspGrantLatency& Get();
+
+	static bool IsEnabled();
+
+	/** Override p.Grasp.Latency.Enable, e.g. for the length of a benchmark */
+	static void SetEnabled(bool bEnabled);
+
+	/** Maps are keyed without the PIE prefix, so the server and its PIE clients share one */
+	static FString GetMapName(const UWorld* World);
+
+	/**
+	 * Called on the server after GiveAbility()
+	 * @param EnterDelay Seconds since the interactor entered grant range
+	 */
+	void OnGiveAbility(const UGraspComponent* GraspComponent, const FGameplayAbilitySpecHandle& Handle, float EnterDelay);
+
+	const FGraspMapGrantLatency* Find(const FString& MapName) const { return Maps.Find(MapName); }
+
+	/** Discard the samples for the map, or every map if empty */
+	void Reset(const FString& MapName = FString());
+
+	void Log(FOutputDevice& Ar) const;
+
+protected:
+	/** Poll the ASC of every PIE client for pending grants, and update the stats if they are dirty and shown */
+	bool Tick(float DeltaTime);
+
+	/** A total was added to the map, its percentiles are shown by stat Grasp once a tick runs while they are read */
+	void OnTotalAdded(const FString& MapName);
+
+	void StartTicker();
+
+	/** Sets the percentiles of StatsMapName, only called while stats are collected */
+	void UpdateStats();
+
+	/** A grant to a remote client whose spec has not arrived yet */
+	struct FPendingGrant
+	{
+		FString MapName;
+		TWeakObjectPtr<const UWorld> World;
+
+		/** World time of GiveAbility() and of entering grant range */
+		double GiveTime = 0.0;
+		double EnterTime = 0.0;
+	};
+
+	TMap<FGameplayAbilitySpecHandle, FPendingGrant> Pending;
+	TMap<FString, FGraspMapGrantLatency> Maps;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	/** Map whose totals stat Grasp shows, and whether it changed since the stats were last set */
+	FString StatsMapName;
+	bool bStatsDirty = false;
+
+	/** Grants whose spec never arrived in this process, e.g. to a standalone client */
+	int32 NumUnresolved = 0;
+};
+
+#endif
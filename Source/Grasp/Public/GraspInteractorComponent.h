@@ -0,0 +1,152 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "GraspTags.h"
+#include "GraspTypes.h"
+#include "GraspScanWatchable.h"
+#include "Components/ActorComponent.h"
+#include "Types/TargetingSystemTypes.h"
+#include "GraspInteractorComponent.generated.h"
+
+class UTargetingPreset;
+class UGraspInteractorComponent;
+class AController;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGraspInteractorTargetsReady, UGraspInteractorComponent* /* Interactor */, const TArray<FGraspScanResult>& /* Results */);
+
+/**
+ * Add to your AIController
+ * Lightweight alternative to UGraspComponent that does not use the Gameplay Ability System
+ * Runs the same targeting presets and filters, but never grants abilities
+ * Results are delivered to OnGraspTargetsReady, and interaction is performed via IGraspableOwner::OnGraspInteract()
+ * Intended for large numbers of AI interactors where ability grants and replication are unnecessary
+ */
+UCLASS(Blueprintable, ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class GRASP_API UGraspInteractorComponent : public UActorComponent, public IGraspScanWatchable
+{
+	GENERATED_BODY()
+
+public:
+	/** Targeting presets for finding graspables to interact with */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category=Grasp)
+	TMap<FGameplayTag, TObjectPtr<UTargetingPreset>> DefaultTargetingPresets = { { FGraspTags::Grasp_Interact, nullptr } };
+
+	/** Determines which actor to use as the source for the targeting request */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	EGraspTargetingSource DefaultTargetingSource = EGraspTargetingSource::Pawn;
+
+	/**
+	 * Grasp will scan for interactables at this rate, if it can keep up
+	 * Set to 0 to disable throttling
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp, meta=(UIMin="0", ClampMin="0", ForceUnits="s"))
+	float MaxGraspScanRate = 0.2f;
+
+	/** Delay before we attempt any requests after encountering an error */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp, AdvancedDisplay, meta=(UIMin="0", ClampMin="0", ForceUnits="s"))
+	float ErrorWaitDelay = 0.5f;
+
+	/** Delay before we request a new target if we don't get one, @see UGraspScanWatchdog */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp, AdvancedDisplay, meta=(UIMin="0", ClampMin="0", ForceUnits="s"))
+	float FailsafeDelay = 1.f;
+
+	/** If true, TryGraspInteract() will fail unless the graspable is within interact range defined by its UGraspData */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Grasp)
+	bool bRequireInteractRange = true;
+
+public:
+	/** Used to throttle the update rate for optimization purposes */
+	UPROPERTY(Transient)
+	float LastGraspScanTime = -1.f;
+
+	/** Current targeting presets that will be used to perform targeting requests */
+	UPROPERTY(Transient, DuplicateTransient)
+	TMap<FGameplayTag, TObjectPtr<UTargetingPreset>> CurrentTargetingPresets;
+
+	/** Existing targeting request handles that are in-progress */
+	UPROPERTY(Transient)
+	TMap<FGameplayTag, FTargetingRequestHandle> TargetingRequests;
+
+	UPROPERTY()
+	FTimerHandle GraspWaitTimer;
+
+	/** Native callback for when a targeting request is completed, populated with the results for that preset */
+	FOnGraspInteractorTargetsReady OnGraspTargetsReady;
+
+protected:
+	/** Owning controller */
+	UPROPERTY(Transient, DuplicateTransient)
+	TObjectPtr<AController> Controller = nullptr;
+
+	/** Last results of each targeting preset */
+	UPROPERTY()
+	TArray<FGraspScanResult> CurrentScanResults;
+
+	/** True while scanning is paused */
+	UPROPERTY(Transient)
+	bool bGraspPaused = true;
+
+public:
+	UGraspInteractorComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/**
+	 * Call when your Pawn receives a controller to begin scanning
+	 * Only needs to be called where the AI runs, typically authority
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void InitializeGraspInteractor();
+
+	/** Get the Targeting Source passed to the targeting system */
+	AActor* GetTargetingSource() const;
+
+	/** Last results of each targeting preset */
+	const TArray<FGraspScanResult>& GetCurrentScanResults() const { return CurrentScanResults; }
+
+	/**
+	 * Interact with the graspable by calling IGraspableOwner::OnGraspInteract() on its owner
+	 * No abilities are activated
+	 * @return True if the owner handled the interaction
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	bool TryGraspInteract(UPrimitiveComponent* GraspableComponent);
+
+	/** Check IGraspableOwner::CanGraspInteract() for the graspable, used in place of CanActivateAbility() */
+	bool CanGraspInteract(const UPrimitiveComponent* GraspableComponent) const;
+
+	/** Pause or resume scanning */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	void PauseGrasp(bool bPaused);
+
+	/** End all in-progress targeting requests */
+	void EndAllTargetingRequests();
+
+	/**
+	 * Called by UGraspScanWatchdog when no targeting request has completed within FailsafeDelay
+	 * @return True if the scan was hung and has been restarted
+	 */
+	virtual bool RecoverFromHang() override;
+
+protected:
+	/** Wait for a bit before trying to request a Grasp again */
+	void WaitForGrasp(float Delay);
+
+	/** This is the main looping function, that looks for GraspableComponent */
+	void RequestGrasp();
+
+	/** Track our in-flight requests with the watchdog, or stop tracking them once none remain */
+	void UpdateWatchdog();
+
+	/** Callback for when a targeting request completes */
+	void OnGraspComplete(FTargetingRequestHandle TargetingHandle, FGameplayTag ScanTag);
+
+	/**
+	 * Cache the results for the preset and notify any listeners
+	 * Override to respond to results without binding to OnGraspTargetsReady
+	 */
+	virtual void GraspTargetsReady(const FGameplayTag& ScanTag, const TArray<FGraspScanResult>& Results);
+};
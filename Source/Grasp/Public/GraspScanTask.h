@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GraspTypes.h"
+#include "GraspScanWatchable.h"
 #include "Abilities/Tasks/AbilityTask.h"
 #include "GraspScanTask.generated.h"
 
@@ -15,7 +16,7 @@ class UGraspComponent;
  * Should only run on Authority
  */
 UCLASS(Config=Game)
-class GRASP_API UGraspScanTask : public UAbilityTask
+class GRASP_API UGraspScanTask : public UAbilityTask, public IGraspScanWatchable
 {
 	GENERATED_BODY()
 
@@ -23,9 +24,6 @@ public:
 	UPROPERTY()
 	FTimerHandle GraspWaitTimer;
 
-	UPROPERTY()
-	FTimerHandle FailsafeTimer;
-
 protected:
 	UPROPERTY()
 	TWeakObjectPtr<UGraspComponent> GC;
@@ -40,7 +38,7 @@ public:
 	 * Grasp's passive perpetual task that scans for interact targets to grant an ability to, prior to interaction
 	 * @param OwningAbility The ability that owns this task
 	 * @param ErrorWaitDelay Delay before we attempt any requests after encountering an error
-	 * @param FailsafeDelay Delay before we request a new target if we don't get one
+	 * @param FailsafeDelay Delay before we request a new target if we don't get one, @see UGraspScanWatchdog
 	 */
 	UFUNCTION(BlueprintCallable, Category="Ability|Tasks", meta = (HidePin = "OwningAbility", DefaultToSelf = "OwningAbility", BlueprintInternalUseOnly = "TRUE", DisplayName="Grasp Scan"))
 	static UGraspScanTask* GraspScan(UGameplayAbility* OwningAbility, float ErrorWaitDelay = 0.5f, float FailsafeDelay = 1.f);
@@ -61,6 +59,12 @@ public:
 	/** Callback for when a GraspableComponent is found */
 	void OnGraspComplete(FTargetingRequestHandle TargetingHandle, FGameplayTag ScanTag);
 
+	/**
+	 * Called by UGraspScanWatchdog when no targeting request has completed within FailsafeDelay
+	 * @return True if the scan was hung and has been restarted
+	 */
+	virtual bool RecoverFromHang() override;
+
 	/** Broadcast from GraspComponent */
 	UFUNCTION()
 	void OnPauseGrasp(bool bPaused);
@@ -78,6 +82,9 @@ protected:
 	UPROPERTY()
 	float FailsafeDelay = 1.f;
 	
+	/** Track our in-flight requests with the watchdog, or stop tracking them once none remain */
+	void UpdateWatchdog();
+
 	ENetMode GetOwnerNetMode() const;
 	FString GetRoleString() const;
 };
@@ -0,0 +1,30 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+
+#include "GraspScanWatchable.generated.h"
+
+UINTERFACE(meta=(CannotImplementInterfaceInBlueprint))
+class GRASP_API UGraspScanWatchable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Implemented by anything that runs async Grasp scans, so UGraspScanWatchdog can restart them if they hang
+ * @see UGraspScanTask, UGraspInteractorComponent
+ */
+class GRASP_API IGraspScanWatchable
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Called by UGraspScanWatchdog when no targeting request has completed within the timeout passed to Watch()
+	 * @return True if the scan was hung and has been restarted
+	 */
+	virtual bool RecoverFromHang() PURE_VIRTUAL(, return false;);
+};
@@ -0,0 +1,58 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GraspScanWatchdog.generated.h"
+
+class IGraspScanWatchable;
+
+/** An in-flight scan tracked by UGraspScanWatchdog */
+struct FGraspScanWatch
+{
+	/** World time the scan started or last made progress */
+	double StartTime = 0.0;
+
+	/** Seconds without progress before the scan is considered hung */
+	float Timeout = 1.f;
+};
+
+/**
+ * Tracks in-flight async Grasp scans and restarts any that hang
+ * The TargetingSubsystem can lose its requests, in which case the scan never gets a callback to continue
+ * One periodic sweep replaces a failsafe timer per scan, see p.Grasp.Watchdog.SweepInterval
+ */
+UCLASS()
+class GRASP_API UGraspScanWatchdog : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Start tracking the scan, or mark it as having made progress if already tracked */
+	void Watch(IGraspScanWatchable* Scan, float Timeout);
+
+	/** Stop tracking the scan, it has no requests in flight */
+	void Unwatch(const IGraspScanWatchable* Scan);
+
+	/** Number of scans currently in flight */
+	int32 GetNumWatched() const { return Watches.Num(); }
+
+	/** Number of hung scans restarted since the world began play */
+	int32 GetNumHangsRecovered() const { return NumHangsRecovered; }
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+protected:
+	/** Restart every scan that has made no progress within its timeout */
+	void Sweep();
+
+	/** Keyed by the object implementing IGraspScanWatchable */
+	TMap<TWeakObjectPtr<UObject>, FGraspScanWatch> Watches;
+
+	FTimerHandle SweepTimer;
+
+	int32 NumHangsRecovered = 0;
+};
@@ -16,6 +16,7 @@ struct FGameplayEventData;
 struct FScalableFloat;
 class UAbilitySystemComponent;
 class UGraspComponent;
+class UGraspInteractorComponent;
 
 /**
  * Helper functions for Grasp
@@ -36,17 +37,27 @@ public:
 	 *
 	 * Payload will only be prepared if bAlwaysTriggerEvent is true or IGraspable::GatherOptionalGraspTargetData() returns any target data
 	 * 
+	 * @param bGatherTargetData If false the target data is not gathered or added to the Payload, only whether there is any
+	 *	is checked via HasOptionalGraspTargetData(), only for payloads that are never sent nor inspected by the ability
 	 * @return True if a Payload was prepared, true if IGraspable::GatherOptionalGraspTargetData() returns any target data
 	 */
 	static bool PrepareGraspAbilityDataPayload(const UPrimitiveComponent* GraspableComponent,
 		FGameplayEventData& Payload, const AActor* SourceActor, const FGameplayAbilityActorInfo* ActorInfo,
-		EGraspAbilityComponentSource Source = EGraspAbilityComponentSource::EventData);
+		EGraspAbilityComponentSource Source = EGraspAbilityComponentSource::EventData, bool bGatherTargetData = true);
+
+	/** Gather the optional target data from the graspable and its owner into OutTargetData, ownership of the target data passes to the caller */
+	static void GatherGraspTargetData(const UPrimitiveComponent* GraspableComponent, const FGameplayAbilityActorInfo* ActorInfo,
+		FGraspTargetDataArray& OutTargetData);
+
+	/** @return True if the graspable or its owner has optional target data, without gathering it where they allow */
+	static bool HasGraspTargetData(const UPrimitiveComponent* GraspableComponent, const FGameplayAbilityActorInfo* ActorInfo);
 
 	UFUNCTION(BlueprintCallable, Category=Grasp)
 	static const UGraspData* GetGraspData(const UPrimitiveComponent* GraspableComponent);
 	
 	/** 
 	 * Check CanActivateAbility()
+	 * The payload given to ShouldAbilityRespondToEvent() includes the optional target data, unless UGraspData::bCanActivateWithoutTargetData
 	 *
 	 * @param SourceActor The actor that holds the UGraspComponent (e.g. Controller), or that can locate the actor holding the component (e.g. Pawn, or PlayerState)
 	 * @param GraspableComponent The component that we are trying to interact with (Grasp)
@@ -134,6 +145,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category=Grasp)
 	static UGraspComponent* FindGraspComponentForPlayerState(APlayerState* PlayerState);
 
+	/**
+	 * Attempts to find a lightweight Grasp Interactor Component for the given Actor
+	 * Will return nullptr on SimulatedProxy
+	 * Attempts to find the component from the controller if available
+	 * Otherwise it will look on the Pawn's Controller if it's a Pawn
+	 */
+	UFUNCTION(BlueprintCallable, Category=Grasp)
+	static UGraspInteractorComponent* FindGraspInteractorForActor(const AActor* Actor);
+
 public:
 	/**
 	 * The GraspableComponent's ability cannot be cleared until ability lock is removed
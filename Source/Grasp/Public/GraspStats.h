@@ -0,0 +1,31 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "HAL/LowLevelMemTracker.h"
+
+DECLARE_STATS_GROUP(TEXT("Grasp"), STATGROUP_Grasp, STATCAT_Advanced);
+
+/** -csvprofile category, totals across every GraspComponent in the process */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(GRASP_API, Grasp);
+
+/** -llm tag for allocations made by Grasp's own containers, see p.Grasp.MemReport for a breakdown */
+LLM_DECLARE_TAG_API(Grasp, GRASP_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scan Requests"), STAT_GraspScanRequests, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Native Scans"), STAT_GraspNativeScans, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Targeting Handles Created"), STAT_GraspTargetingHandlesCreated, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Targeting Handles Reused"), STAT_GraspTargetingHandlesReused, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Line of Sight Traces"), STAT_GraspLineOfSightTraces, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Line of Sight Cache Hits"), STAT_GraspLineOfSightCacheHits, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Targets Skipped Beyond Max Range"), STAT_GraspTargetsSkippedBeyondMaxRange, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Can Activate Memo Hits"), STAT_GraspCanActivateMemoHits, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Can Activate Memo Misses"), STAT_GraspCanActivateMemoMisses, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Scan Hangs Recovered"), STAT_GraspScanHangsRecovered, STATGROUP_Grasp, GRASP_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Persistent Targeting Handles"), STAT_GraspPersistentTargetingHandles, STATGROUP_Grasp, GRASP_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Grant Latency p50 (ms)"), STAT_GraspGrantLatencyP50, STATGROUP_Grasp, GRASP_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Grant Latency p95 (ms)"), STAT_GraspGrantLatencyP95, STATGROUP_Grasp, GRASP_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Request Grasp"), STAT_GraspRequestGrasp, STATGROUP_Grasp, GRASP_API);
@@ -7,9 +7,19 @@
 #include "GraspTypes.generated.h"
 
 class UGraspComponent;
+struct FGameplayAbilityTargetData;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogGrasp, Log, All);
 
+/** Visual Logger category for scan selection, filter rejections, and ability grants */
+DECLARE_LOG_CATEGORY_EXTERN(LogGraspScan, Log, All);
+
+/**
+ * Caller owned buffer for gathered optional target data, small amounts never allocate
+ * Ownership of the target data passes to whoever adds it to a FGameplayAbilityTargetDataHandle
+ */
+using FGraspTargetDataArray = TArray<FGameplayAbilityTargetData*, TInlineAllocator<4>>;
+
 /**
  * How Grasp abilities retrieve their GraspableComponent
  * Determine what checks are done from the ability
@@ -22,6 +32,16 @@ enum class EGraspAbilityComponentSource : uint8
 	Custom			UMETA(ToolTip="Unimplemented -- use a focus system or similar to determine which GraspableComponent we're interacting with. Results in ActivateAbility()"),
 };
 
+/**
+ * How UGraspComponent runs its targeting presets
+ */
+UENUM(BlueprintType)
+enum class EGraspScanBackend : uint8
+{
+	TargetingSystem				UMETA(ToolTip="Run every targeting preset as an async request through the TargetingSubsystem"),
+	Native						UMETA(ToolTip="Run targeting presets made of a UGraspTargetSelection followed only by Grasp filters synchronously, without the TargetingSubsystem. Any other preset uses the TargetingSubsystem"),
+};
+
 UENUM(BlueprintType)
 enum class EGraspTargetingSource : uint8
 {
@@ -4,11 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "GraspTypes.h"
 
 #include "GraspableComponent.generated.h"
 
 struct FGameplayAbilityActorInfo;
 struct FGameplayAbilityTargetData;
+struct FGraspDataRuntime;
 class UGraspData;
 
 UINTERFACE()
@@ -36,6 +38,13 @@ public:
 	 */
 	virtual const UGraspData* GetGraspData() const PURE_VIRTUAL(, return nullptr;);
 
+	/**
+	 * The compiled GetGraspData() used by the scan hot paths
+	 * Resolved once and cached, re-resolved if the GraspData changes
+	 * @return nullptr if there is no GraspData
+	 */
+	const FGraspDataRuntime* GetGraspDataRuntime() const;
+
 	/** 
 	 * Optional additional target data that will be passed to the ability when the graspable is interacted with.
 	 * @return The optional target data for this graspable.
@@ -44,6 +53,23 @@ public:
 	{
 		return {};
 	}
+
+	/**
+	 * Gather the optional target data into a caller owned buffer, used in place of GatherOptionalGraspTargetData()
+	 * Defaults to appending GatherOptionalGraspTargetData(), override this instead to avoid allocating a TArray
+	 */
+	virtual void GatherOptionalGraspTargetDataInto(const FGameplayAbilityActorInfo* ActorInfo, FGraspTargetDataArray& OutTargetData) const
+	{
+		OutTargetData.Append(GatherOptionalGraspTargetData(ActorInfo));
+	}
+
+	/**
+	 * Used when only the presence of target data matters, i.e. EGraspAbilityComponentSource::Automatic in CanGraspActivateAbility()
+	 * for GraspData with bCanActivateWithoutTargetData
+	 * Defaults to gathering and discarding the target data, override this if it can be answered without gathering
+	 * @return True if GatherOptionalGraspTargetData() or GatherOptionalGraspTargetDataInto() would return any target data
+	 */
+	virtual bool HasOptionalGraspTargetData(const FGameplayAbilityActorInfo* ActorInfo) const;
 	
 	/**
 	 * Dead graspables have their abilities removed from the Pawn that they were granted to.
@@ -56,6 +82,10 @@ public:
 	 * @return True if this graspable is no longer available, e.g. a Barrel that is exploding, a Pawn who is dying.
 	 */
 	virtual bool IsGraspableDead() const { return false; }
+
+private:
+	/** Cached index into FGraspDataRuntimeTable */
+	mutable int32 GraspDataRuntimeIndex = INDEX_NONE;
 };
 
 // Inheritance band-aid...
@@ -4,12 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "GraspTypes.h"
 
 #include "GraspableOwner.generated.h"
 
 struct FGameplayAbilityActorInfo;
 struct FGameplayAbilityTargetData;
 class UGraspData;
+class UPrimitiveComponent;
 
 UINTERFACE()
 class GRASP_API UGraspableOwner : public UInterface
@@ -33,6 +35,23 @@ public:
 	{
 		return {};
 	}
+
+	/**
+	 * Gather the optional target data into a caller owned buffer, used in place of GatherOptionalGraspTargetData()
+	 * Defaults to appending GatherOptionalGraspTargetData(), override this instead to avoid allocating a TArray
+	 */
+	virtual void GatherOptionalGraspTargetDataInto(const FGameplayAbilityActorInfo* ActorInfo, FGraspTargetDataArray& OutTargetData) const
+	{
+		OutTargetData.Append(GatherOptionalGraspTargetData(ActorInfo));
+	}
+
+	/**
+	 * Used when only the presence of target data matters, i.e. EGraspAbilityComponentSource::Automatic in CanGraspActivateAbility()
+	 * for GraspData with bCanActivateWithoutTargetData
+	 * Defaults to gathering and discarding the target data, override this if it can be answered without gathering
+	 * @return True if GatherOptionalGraspTargetData() or GatherOptionalGraspTargetDataInto() would return any target data
+	 */
+	virtual bool HasOptionalGraspTargetData(const FGameplayAbilityActorInfo* ActorInfo) const;
 	
 	/**
 	 * Dead graspables have their abilities removed from the Pawn that they were granted to.
@@ -47,4 +66,24 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category=Grasp)
 	bool IsGraspableDead() const;
 	virtual bool IsGraspableDead_Implementation() const { return false;	}
+
+	/**
+	 * Used by UGraspInteractorComponent in place of CanActivateAbility(), no abilities are involved
+	 * @param Interactor The targeting source of the UGraspInteractorComponent, typically the AI's Pawn
+	 * @param GraspableComponent The component being interacted with
+	 * @return True if the Interactor can interact with the GraspableComponent
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category=Grasp)
+	bool CanGraspInteract(const AActor* Interactor, const UPrimitiveComponent* GraspableComponent) const;
+	virtual bool CanGraspInteract_Implementation(const AActor* Interactor, const UPrimitiveComponent* GraspableComponent) const { return true; }
+
+	/**
+	 * Called by UGraspInteractorComponent::TryGraspInteract() in place of activating a grasp ability
+	 * @param Interactor The targeting source of the UGraspInteractorComponent, typically the AI's Pawn
+	 * @param GraspableComponent The component being interacted with
+	 * @return True if the interaction was handled
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category=Grasp)
+	bool OnGraspInteract(AActor* Interactor, UPrimitiveComponent* GraspableComponent);
+	virtual bool OnGraspInteract_Implementation(AActor* Interactor, UPrimitiveComponent* GraspableComponent) { return false; }
 };
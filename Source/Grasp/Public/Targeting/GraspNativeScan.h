@@ -0,0 +1,28 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UTargetingPreset;
+struct FGraspScanResult;
+struct FTargetingRequestHandle;
+
+/**
+ * Native scan backend, runs a Grasp targeting preset synchronously without the TargetingSubsystem
+ * The selection runs immediately, then every target is passed through each filter in turn and converted to a scan result
+ * @see EGraspScanBackend
+ */
+struct GRASP_API FGraspNativeScan
+{
+	/** @return True if the preset is a UGraspTargetSelection followed only by UGraspFilterTask filters */
+	static bool IsCompatible(const UTargetingPreset* Preset);
+
+	/**
+	 * Run the preset against the handle, the preset must be compatible
+	 * The handle only provides the source context and result set, it is never queued with the TargetingSubsystem
+	 */
+	static void Execute(const UTargetingPreset* Preset, const FTargetingRequestHandle& TargetingHandle,
+		const FGameplayTag& ScanTag, TArray<FGraspScanResult>& OutResults);
+};
@@ -7,6 +7,8 @@
 #include "Tasks/TargetingSelectionTask_AOE.h"
 #include "GraspTargetSelection.generated.h"
 
+struct FGraspSelectionContext;
+
 /**
  * Extend targeting for interaction selection
  * Adds location and rotation sources
@@ -61,6 +63,14 @@ protected:
 	/** When enabled, the trace will be performed against complex collision. */
 	UPROPERTY(EditAnywhere, Category="Grasp Selection")
 	uint8 bTraceComplex : 1 = false;
+
+	/**
+	 * Sort the results nearest first, storing the 2D distance squared from the source actor in the result Score
+	 * Range filters stop evaluating at the first result that is beyond the range of every UGraspData
+	 * Any task between this and the range filters must not change the order or Score of the results
+	 */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection")
+	uint8 bSortByDistance : 1;
 	
 protected:
 	/** Indicates the trace should ignore the source actor */
@@ -132,6 +142,30 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(ForceUnits="x", EditCondition="MovementSelectionMode!=EGraspMovementSelectionMode::Disabled&&(ShapeType==EGraspTargetingShape::CharacterCapsule)", EditConditionHides))
 	FScalableFloat MaxHalfHeightScalar;
 
+	/**
+	 * Length of the cone or frustum along the source rotation
+	 * Typically paired with ViewRotation or Camera rotation sources for first-person interaction
+	 * MovementSelectionMode does not apply to these shapes
+	 */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", ForceUnits="cm", EditCondition="ShapeType==EGraspTargetingShape::Cone||ShapeType==EGraspTargetingShape::Frustum", EditConditionHides))
+	float ViewLength;
+
+	/** Half angle of the cone */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", UIMax="89", ClampMax="89", ForceUnits="Degrees", EditCondition="ShapeType==EGraspTargetingShape::Cone", EditConditionHides))
+	float ConeHalfAngle;
+
+	/** Half horizontal field of view of the frustum */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", UIMax="89", ClampMax="89", ForceUnits="Degrees", EditCondition="ShapeType==EGraspTargetingShape::Frustum", EditConditionHides))
+	float FrustumHalfFOV;
+
+	/** Half vertical field of view of the frustum */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", UIMax="89", ClampMax="89", ForceUnits="Degrees", EditCondition="ShapeType==EGraspTargetingShape::Frustum", EditConditionHides))
+	float FrustumHalfVerticalFOV;
+
+	/** Graspables closer than this to the source are not selected by the frustum */
+	UPROPERTY(EditAnywhere, Category="Grasp Selection Shape", meta=(UIMin="0", ClampMin="0", ForceUnits="cm", EditCondition="ShapeType==EGraspTargetingShape::Frustum", EditConditionHides))
+	float FrustumNearDistance;
+
 	float GetMaxRadius() const { return MovementSelectionMode != EGraspMovementSelectionMode::Disabled ? MaxRadius.GetValue() : Radius.GetValue(); }
 	float GetMaxHalfHeight() const { return MovementSelectionMode != EGraspMovementSelectionMode::Disabled ? MaxHalfHeight.GetValue() : HalfHeight.GetValue(); }
 	float GetMaxRadiusScalar() const { return MovementSelectionMode != EGraspMovementSelectionMode::Disabled ? MaxRadiusScalar.GetValue() : RadiusScalar.GetValue(); }
@@ -187,10 +221,19 @@ public:
 	/** Evaluation function called by derived classes to process the targeting request */
 	virtual void Execute(const FTargetingRequestHandle& TargetingHandle) const override;
 
+	/**
+	 * Used by the native scan backend in place of Execute()
+	 * Always runs immediately and does not update the task state
+	 */
+	virtual void ExecuteNative(const FTargetingRequestHandle& TargetingHandle) const;
+
 protected:
 	/** Method to process the trace task immediately */
 	void ExecuteImmediateTrace(const FTargetingRequestHandle& TargetingHandle) const;
 
+	/** Perform the overlap immediately */
+	void OverlapImmediate(const FTargetingRequestHandle& TargetingHandle, const UWorld* World, TArray<FOverlapResult>& OutOverlapResults) const;
+
 	/** Method to process the trace task asynchronously */
 	void ExecuteAsyncTrace(const FTargetingRequestHandle& TargetingHandle) const;
 
@@ -203,13 +246,53 @@ protected:
 	 * @return Num valid results
 	 */
 	int32 ProcessOverlapResults(const FTargetingRequestHandle& TargetingHandle, const TArray<FOverlapResult>& Overlaps) const;
+
+	/**
+	 * Scan LOD fine tier, store the candidates from the last coarse scan in the targeting result data without a broadphase
+	 * @return Num valid results
+	 */
+	int32 ProcessCandidates(const FTargetingRequestHandle& TargetingHandle,
+		const TArray<TWeakObjectPtr<UPrimitiveComponent>>& Candidates) const;
+
+	/** Score the results by distance from the source actor and sort them nearest first */
+	void SortResultsByDistance(const FTargetingRequestHandle& TargetingHandle, TArray<FTargetingDefaultResultData>& TargetResults) const;
 	
 protected:
-	/** Helper method to build the Collision Shape */
+	/**
+	 * Resolve the source and shape for the request and store them with the handle
+	 * Called when the selection executes, everything after reads it with GetSelectionContext()
+	 */
+	const FGraspSelectionContext& MakeSelectionContext(const FTargetingRequestHandle& TargetingHandle) const;
+
+	/** The context made for the request, makes it now if there isn't one */
+	const FGraspSelectionContext& GetSelectionContext(const FTargetingRequestHandle& TargetingHandle) const;
+
+	/** Remove the context once the selection has completed */
+	static void ReleaseSelectionContext(const FTargetingRequestHandle& TargetingHandle);
+
+	/**
+	 * Helper method to build the Collision Shape
+	 * Cone and Frustum return a box that conservatively bounds them, ProcessOverlapResults() performs the exact test
+	 */
 	FCollisionShape GetCollisionShape(const FTargetingRequestHandle& TargetingHandle) const;
+	FCollisionShape GetCollisionShape(const FTargetingRequestHandle& TargetingHandle, float MovementAlpha) const;
+
+	/** Where to perform the overlap, Cone and Frustum bounds are pushed forward along the source rotation */
+	FVector GetCollisionShapeLocation(const FVector& SourceLocation, const FQuat& SourceRotation) const;
+
+	/**
+	 * Exact shape test for shapes that are approximated by the overlap, i.e. Cylinder, Cone, and Frustum
+	 * @return True if the location is within the shape
+	 */
+	bool IsWithinShape(const FVector& SourceLocation, const FQuat& SourceRotation, const FVector& Location) const;
 	
 	/** Setup CollisionQueryParams for the AOE */
 	void InitCollisionParams(const FTargetingRequestHandle& TargetingHandle, FCollisionQueryParams& OutParams) const;
+
+#if ENABLE_VISUAL_LOG
+	/** Record the selection shape and its results to the Visual Logger of the source actor */
+	void VisLogSelection(const FTargetingRequestHandle& TargetingHandle, int32 NumValidResults) const;
+#endif
 	
 public:
 	/** Debug draws the outlines of the set shape type. */
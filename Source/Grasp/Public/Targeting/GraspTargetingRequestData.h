@@ -0,0 +1,141 @@
+﻿// Copyright (c) Jared Taylor
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionShape.h"
+#include "Types/TargetingSystemTypes.h"
+
+class UPrimitiveComponent;
+class UTargetingPreset;
+
+/**
+ * Which tier of the scan LOD a targeting request belongs to
+ * @see UGraspComponent::bEnableScanLOD
+ */
+enum class EGraspScanTier : uint8
+{
+	Full,		// Scan LOD is disabled, the request runs normally
+	Coarse,		// Runs the broadphase and gathers the candidate set
+	Fine,		// Re-evaluates the candidate set without a broadphase
+};
+
+/** Number of candidates either side of a filter, collected for the Gameplay Debugger */
+struct FGraspFilterDebugCount
+{
+	FName Filter;
+	int32 NumBefore = 0;
+	int32 NumAfter = 0;
+};
+
+/**
+ * Grasp's per-request data that the Targeting System has no place for
+ * Keyed by the targeting request handle, added before the request starts and removed once it completes or is ended
+ * Game thread only
+ */
+struct GRASP_API FGraspTargetingRequestData
+{
+	EGraspScanTier Tier = EGraspScanTier::Full;
+
+	/** Coarse: populated by UGraspTargetSelection with every component it overlapped */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Candidates;
+
+	/** Fine: evaluated by UGraspTargetSelection in place of an overlap, shared with FGraspScanLODState rather than copied */
+	TSharedPtr<const TArray<TWeakObjectPtr<UPrimitiveComponent>>> FineCandidates;
+
+	/** @return FineCandidates, or an empty array if there are none */
+	const TArray<TWeakObjectPtr<UPrimitiveComponent>>& GetFineCandidates() const
+	{
+		static const TArray<TWeakObjectPtr<UPrimitiveComponent>> Empty;
+		return FineCandidates.IsValid() ? *FineCandidates : Empty;
+	}
+
+	/**
+	 * Set by UGraspTargetSelection once it has written the 2D distance squared to each Score and sorted by it
+	 * The range filters only cut off the results beyond the max range when this is set
+	 */
+	bool bSortedByDistance = false;
+
+	/** Set while the Gameplay Debugger inspects the scan, filters then record FilterCounts */
+	bool bCollectDebug = false;
+
+	/** FPlatformTime::Seconds() when the request started, if bCollectDebug */
+	double DebugStartTime = 0.0;
+
+	/** Filled by each Grasp filter in the order they execute, if bCollectDebug */
+	TArray<FGraspFilterDebugCount> FilterCounts;
+
+	static FGraspTargetingRequestData* Find(const FTargetingRequestHandle& Handle);
+	static FGraspTargetingRequestData& FindOrAdd(const FTargetingRequestHandle& Handle);
+	static void Remove(const FTargetingRequestHandle& Handle);
+
+	/** Bytes allocated by every request's data */
+	static SIZE_T GetStoreAllocatedSize();
+
+private:
+	static TMap<FTargetingRequestHandle, FGraspTargetingRequestData>& GetStore();
+};
+
+/**
+ * Everything UGraspTargetSelection resolves from the targeting source, once per request
+ * Avoids calling the source native events for every step, they go through the Blueprint VM when overridden
+ * Added when the selection executes and removed once it completes
+ * Game thread only
+ */
+struct GRASP_API FGraspSelectionContext
+{
+	/** Source location with the offset applied */
+	FVector SourceLocation = FVector::ZeroVector;
+
+	/** Source rotation with the offset applied */
+	FQuat SourceRotation = FQuat::Identity;
+
+	/** Where the overlap is performed, ahead of SourceLocation for Cone and Frustum */
+	FVector ShapeLocation = FVector::ZeroVector;
+
+	/** @see UGraspTargetSelection::CalcPawnMovementAlpha() */
+	float MovementAlpha = 0.f;
+
+	FCollisionShape CollisionShape;
+
+	static FGraspSelectionContext* Find(const FTargetingRequestHandle& Handle);
+	static FGraspSelectionContext& FindOrAdd(const FTargetingRequestHandle& Handle);
+	static void Remove(const FTargetingRequestHandle& Handle);
+
+	/** Bytes allocated by every request's context */
+	static SIZE_T GetStoreAllocatedSize();
+
+private:
+	static TMap<FTargetingRequestHandle, FGraspSelectionContext>& GetStore();
+};
+
+/** Scan LOD state maintained by UGraspComponent for each targeting preset */
+struct FGraspScanLODState
+{
+	/** Components overlapped by the last coarse scan, immutable so fine requests can share it */
+	TSharedPtr<const TArray<TWeakObjectPtr<UPrimitiveComponent>>> Candidates;
+
+	/** World time of the last completed coarse scan */
+	float LastCoarseScanTime = -1.f;
+};
+
+/** Scan diagnostics kept by UGraspComponent for each targeting preset while the Gameplay Debugger inspects it */
+struct FGraspScanDebugInfo
+{
+	/** Time from starting the last request to its completion */
+	float LastLatencyMs = 0.f;
+
+	EGraspScanTier LastTier = EGraspScanTier::Full;
+
+	/** Filter counts of the last request */
+	TArray<FGraspFilterDebugCount> FilterCounts;
+};
+
+/** Targeting request handle kept alive between scans by UGraspComponent for each targeting preset */
+struct FGraspPersistentTargetingRequest
+{
+	FTargetingRequestHandle Handle;
+
+	/** Preset the handle was made for, the handle is remade if the preset changes */
+	TWeakObjectPtr<const UTargetingPreset> Preset;
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "GraspTargetingTypes.h"
+#include "GraspTypes.h"
 #include "Engine/EngineTypes.h"
 #include "CollisionQueryParams.h" 
 #include "GraspTargetingStatics.generated.h"
@@ -39,4 +40,17 @@ public:
 	/** Setup CollisionQueryParams for the AOE */
 	static void InitCollisionParams(const FTargetingRequestHandle& TargetingHandle, FCollisionQueryParams& OutParams,
 		bool bIgnoreSourceActor = true, bool bIgnoreInstigatorActor = false, bool bTraceComplex = false);
+
+	/**
+	 * Convert the results of a completed Grasp targeting request to scan results
+	 * Expects UGraspTargetSelection to have output the GraspAbilityRadius as the hit distance
+	 */
+	static void GetGraspScanResults(const FTargetingRequestHandle& TargetingHandle, const FGameplayTag& ScanTag,
+		TArray<FGraspScanResult>& OutResults);
+
+	/**
+	 * Convert a single targeting result to a scan result
+	 * @return True if a scan result was added
+	 */
+	static bool AddGraspScanResult(FHitResult& Hit, const FGameplayTag& ScanTag, TArray<FGraspScanResult>& OutResults);
 };
@@ -14,6 +14,8 @@ enum class EGraspTargetingShape : uint8
 	Sphere,
 	Capsule,
 	CharacterCapsule,
+	Cone					UMETA(ToolTip="Cone along the source rotation, use with ViewRotation or Camera for first-person interaction"),
+	Frustum					UMETA(ToolTip="View frustum along the source rotation, use with ViewRotation or Camera for first-person interaction"),
 };
 
 UENUM(BlueprintType)
@@ -32,6 +34,7 @@ enum class EGraspTargetRotationSource : uint8
 	ViewRotation,
 	Velocity,
 	Acceleration,
+	Camera,
 };
 
 UENUM(BlueprintType)